@@ -0,0 +1,103 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Occupancy Benchmark
+ * ============================================================================
+ * 
+ * File: occupancy_bench.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Grows a snake along a serpentine path to several thousand segments and
+ * times Snake::Update and Snake::SnakeCell at each length. Both should stay
+ * flat as the snake grows now that they consult the occupancy bitmap.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "snake.h"
+
+namespace {
+
+constexpr int kGridWidth{128};
+constexpr int kGridHeight{128};
+
+// Boustrophedon walk: right along even rows, left along odd rows, stepping
+// down at each edge. The snake never meets its own tail on the way.
+void Steer(Snake &snake) {
+  int x = static_cast<int>(snake.head_x);
+  int y = static_cast<int>(snake.head_y);
+  bool even_row = (y % 2) == 0;
+  if (even_row && x == kGridWidth - 1) {
+    snake.direction = Snake::Direction::kDown;
+  } else if (!even_row && x == 0) {
+    snake.direction = Snake::Direction::kDown;
+  } else {
+    snake.direction =
+        even_row ? Snake::Direction::kRight : Snake::Direction::kLeft;
+  }
+}
+
+double NanosPerCall(std::chrono::steady_clock::duration elapsed, long calls) {
+  return std::chrono::duration<double, std::nano>(elapsed).count() / calls;
+}
+
+}  // namespace
+
+int main() {
+  constexpr long kUpdates{200000};
+  constexpr long kQueries{2000000};
+
+  Snake snake(kGridWidth, kGridHeight);
+  snake.speed = 1.0f;  // One cell per update keeps every call a real move.
+
+  // Pre-draw the query cells so the timing loop measures only the lookup.
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<int> random_w(0, kGridWidth - 1);
+  std::uniform_int_distribution<int> random_h(0, kGridHeight - 1);
+  std::vector<Point> queries(4096);
+  for (auto &cell : queries) {
+    cell = {random_w(engine), random_h(engine)};
+  }
+
+  std::printf("%10s %16s %18s\n", "length", "Update (ns)", "SnakeCell (ns)");
+  for (int target : {16, 64, 256, 1024, 4096, 8192}) {
+    while (snake.size < target) {
+      Steer(snake);
+      snake.GrowBody();
+      snake.Update();
+    }
+    if (!snake.alive) {
+      std::fprintf(stderr, "snake died while growing to %d\n", target);
+      return 1;
+    }
+
+    Snake probe = snake;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < kUpdates; ++i) {
+      Steer(probe);
+      probe.Update();
+    }
+    double update_ns = NanosPerCall(std::chrono::steady_clock::now() - start,
+                                    kUpdates);
+
+    long hits = 0;
+    start = std::chrono::steady_clock::now();
+    for (long i = 0; i < kQueries; ++i) {
+      Point const &cell = queries[i & 4095];
+      hits += snake.SnakeCell(cell.x, cell.y);
+    }
+    double query_ns = NanosPerCall(std::chrono::steady_clock::now() - start,
+                                   kQueries);
+
+    std::printf("%10d %16.1f %18.1f   (hits %ld)\n", snake.size, update_ns,
+                query_ns, hits);
+  }
+  return 0;
+}
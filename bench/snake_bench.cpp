@@ -0,0 +1,719 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Hot Path Microbenchmarks
+ * ============================================================================
+ * 
+ * File: snake_bench.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Times the game's hot paths in isolation: snake movement and occupancy
+ * queries at increasing lengths, food placement at increasing board fill
+ * (up to the 99%-full worst case), particle emission and update at
+ * increasing particle counts (sequential and on the worker pool up to a
+ * million), sound bank synthesis and cache loading, and the renderer's
+ * draw helpers and whole frames against SDL's software renderer on the
+ * dummy video driver, including whole snake bodies drawn as straight
+ * runs and frames on boards far larger than the window, which should cost
+ * the same whatever the board size.
+ * 
+ * Each case is repeated in doubling batches until it has run for at least
+ * kMinSeconds, then reported as nanoseconds per operation. Results are
+ * written as JSON so runs of different builds can be diffed.
+ * 
+ * --audio-latency runs only the audio latency mode instead. For each
+ * device buffer size it opens the audio device on SDL's disk driver
+ * (output discarded; pass --audio-driver to test a real device), plays
+ * eat sounds at random intervals for a few seconds, and reports:
+ *   - play-to-callback latency: from PlayEatSound() to the start of the
+ *     callback that mixes the sound. Add one buffer period for playout.
+ *   - callback CPU time.
+ *   - underruns: callbacks that started more than 1.5 buffer periods
+ *     after the previous one, so the device would have run dry.
+ * 
+ * Usage:
+ *   snake_bench [--out results.json] [--filter substring]
+ *   snake_bench --audio-latency [--audio-driver NAME] [--seconds S]
+ *               [--out results.json]
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SDL.h"
+#include "particle.h"
+#include "render_snapshot.h"
+#include "renderer.h"
+#include "audio.h"
+#include "audio_mixer.h"
+#include "board_limits.h"
+#include "simulation.h"
+#include "sound_bank.h"
+#include "work_stealing_pool.h"
+
+// Friend of Renderer (see renderer.h): exposes the private draw helpers.
+struct RendererBenchAccess {
+  static SDL_Renderer *Target(Renderer &r) { return r.sdl_renderer; }
+  static void DrawCircle(Renderer &r, int radius) {
+    r.DrawCircle(320, 320, radius, 255, 215, 0, 255);
+  }
+  static void RoundedRect(Renderer &r, int w, int h, int radius) {
+    r.RenderRoundedRect(SDL_Rect{100, 100, w, h}, radius, 40, 60, 40, 220);
+  }
+  static void BitmapText(Renderer &r, std::string const &text) {
+    r.RenderBitmapText(text, 20, 22, 2);
+  }
+  static void GlyphText(Renderer &r, std::string const &text) {
+    r.bitmap_font.DrawText(r.batch, text, 10, 10, 2);
+  }
+  static void Flush(Renderer &r) { r.batch.Flush(); }
+  static std::size_t DrawCalls(Renderer &r) { return r.batch.DrawCalls(); }
+  static std::size_t Quads(Renderer &r) { return r.batch.Quads(); }
+  // The whole body, as drawn when the snake layer is unavailable.
+  static void SnakeBody(Renderer &r, RenderSnapshot const &snapshot) {
+    SnakeLayer::SplitRuns(snapshot.body, snapshot.body_end_seq, r.snake_layer_runs);
+    for (SnakeLayer::Run const &run : r.snake_layer_runs) {
+      r.RenderSnakeRun(run.first, run.last, SnakeLayer::BandRatio(run.band));
+    }
+  }
+  static void ResetStats(Renderer &r) { r.batch.ResetStats(); }
+  static ParticleSystem &Particles(Renderer &r) { return r.particle_system; }
+  static void GradientBackground(Renderer &r) { r.RenderGradientBackground(); }
+  static void GameOverScreen(Renderer &r, int score) {
+    r.RenderGameOverScreen(score);
+  }
+  static void RebuildBackground(Renderer &r) {
+    r.RebuildBackgroundTexture(r.background_width, r.background_height);
+    r.RenderGradientBackground();
+  }
+};
+
+namespace {
+
+constexpr double kMinSeconds{0.2};
+
+struct Result {
+  std::string name;
+  std::string parameter;
+  long iterations;
+  double ns_per_op;
+};
+
+std::vector<Result> results;
+std::string filter;
+
+// Results are folded into this so the optimiser cannot drop the work.
+volatile long sink;
+
+// Runs `body(n)` (which must perform n operations) in doubling batches
+// until the batch takes at least kMinSeconds.
+void Measure(std::string const &name, std::string const &parameter,
+             std::function<void(long)> const &body) {
+  if (!filter.empty() && (name + "/" + parameter).find(filter) == std::string::npos) {
+    return;
+  }
+  long iterations = 1;
+  while (true) {
+    auto const start = std::chrono::steady_clock::now();
+    body(iterations);
+    double const seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    if (seconds >= kMinSeconds || iterations >= (1L << 40)) {
+      double const ns = seconds * 1e9 / iterations;
+      results.push_back({name, parameter, iterations, ns});
+      std::printf("%-36s %-14s %14.1f ns/op  (%ld iters)\n", name.c_str(),
+                  parameter.c_str(), ns, iterations);
+      return;
+    }
+    iterations *= 2;
+  }
+}
+
+// --- Snake / simulation ------------------------------------------------------
+
+constexpr int kBoardSize{64};
+
+// Steers along a boustrophedon cycle that covers the whole board, so the
+// snake can be grown to any length short of full without colliding.
+void Serpentine(Snake &snake, int width) {
+  int const x = static_cast<int>(snake.head_x);
+  int const y = static_cast<int>(snake.head_y);
+  bool const even_row = (y % 2) == 0;
+  if ((even_row && x == width - 1) || (!even_row && x == 0)) {
+    snake.direction = Snake::Direction::kDown;
+  } else {
+    snake.direction =
+        even_row ? Snake::Direction::kRight : Snake::Direction::kLeft;
+  }
+}
+
+// A playing simulation whose snake covers `fill` of the board.
+Simulation MakeFilledGame(double fill) {
+  Simulation game(kBoardSize, kBoardSize, 7);
+  game.Start();
+  Snake &snake = game.GetSnake();
+  snake.speed = 1.0f;
+  int const target = static_cast<int>(fill * kBoardSize * kBoardSize);
+  while (snake.size < target) {
+    Serpentine(snake, kBoardSize);
+    snake.GrowBody();
+    snake.Update();
+  }
+  return game;
+}
+
+std::string Percent(double fill) {
+  std::ostringstream out;
+  out << fill * 100.0 << "%";
+  return out.str();
+}
+
+void BenchSimulation() {
+  for (double fill : {0.01, 0.25, 0.5, 0.9, 0.99}) {
+    Simulation game = MakeFilledGame(fill);
+
+    Measure("Snake::Update", Percent(fill), [&](long n) {
+      Snake snake = game.GetSnake();
+      for (long i = 0; i < n; ++i) {
+        Serpentine(snake, kBoardSize);
+        snake.Update();
+      }
+      sink = snake.size;
+    });
+
+    Measure("Snake::SnakeCell", Percent(fill), [&](long n) {
+      Snake const &snake = game.GetSnake();
+      long hits = 0;
+      for (long i = 0; i < n; ++i) {
+        int const cell = static_cast<int>((i * 2654435761u) & (kBoardSize * kBoardSize - 1));
+        hits += snake.SnakeCell(cell % kBoardSize, cell / kBoardSize);
+      }
+      sink = hits;
+    });
+
+    Measure("Simulation::PlaceFood", Percent(fill), [&](long n) {
+      for (long i = 0; i < n; ++i) {
+        game.PlaceFood();
+      }
+    });
+  }
+}
+
+// --- Particles --------------------------------------------------------------
+
+// The array-of-structs particle and compaction the pool replaced, kept as
+// the baseline for the SoA update numbers.
+struct AosParticle {
+  float x, y, prev_x, prev_y, velocity_x, velocity_y, life, max_life;
+  Uint8 r, g, b, a;
+  float size;
+
+  void Update(float dt) {
+    prev_x = x;
+    prev_y = y;
+    x += velocity_x * dt;
+    y += velocity_y * dt;
+    life -= dt;
+    a = static_cast<Uint8>((life / max_life) * 255);
+    velocity_y += 50.0f * dt;
+  }
+};
+
+void UpdateAos(std::vector<AosParticle> &particles, float dt) {
+  for (auto &particle : particles) {
+    particle.Update(dt);
+  }
+  particles.erase(std::remove_if(particles.begin(), particles.end(),
+                                 [](AosParticle const &p) { return p.life <= 0; }),
+                  particles.end());
+}
+
+void BenchParticles() {
+  for (int count : {100, 1000, 10000, 100000}) {
+    std::string const parameter = std::to_string(count);
+
+    Measure("ParticleSystem::EmitFoodParticles", parameter, [&](long n) {
+      ParticleSystem particles;
+      for (long i = 0; i < n; ++i) {
+        if (i % count == 0) {
+          particles.Clear();
+        }
+        particles.EmitFoodParticles(16.0f, 16.0f, 1);
+      }
+    });
+
+    ParticleSystem particles;
+    particles.EmitFoodParticles(16.0f, 16.0f, count);
+    // A tiny step keeps the population alive for the whole measurement.
+    Measure("ParticleSystem::Update", parameter, [&](long n) {
+      for (long i = 0; i < n; ++i) {
+        particles.Update(1e-6f);
+      }
+    });
+
+    std::vector<AosParticle> baseline;
+    for (int i = 0; i < count; ++i) {
+      float const angle = 0.001f * i;
+      baseline.push_back(AosParticle{16.0f, 16.0f, 16.0f, 16.0f,
+                                     std::cos(angle) * 100.0f,
+                                     std::sin(angle) * 100.0f, 1.0f + (i % 7) * 0.1f,
+                                     1.0f + (i % 7) * 0.1f, 255, 200, 0, 255, 2.0f});
+    }
+    Measure("ParticleSystem::Update", parameter + " AoS baseline", [&](long n) {
+      for (long i = 0; i < n; ++i) {
+        UpdateAos(baseline, 1e-6f);
+      }
+    });
+  }
+
+  // Fireworks densities, single-threaded against the worker pool. Both
+  // runs use the same seed and produce identical particles.
+  WorkStealingPool pool;
+  for (int count : {10000, 100000, 1000000}) {
+    for (bool parallel : {false, true}) {
+      ParticleSystem particles(1 << 20, 1234);
+      if (parallel) {
+        particles.SetWorkerPool(&pool);
+      }
+      particles.EmitFireworkParticles(16.0f, 16.0f, count);
+      std::string const parameter =
+          std::to_string(count) + (parallel ? " parallel x" + std::to_string(pool.ThreadCount())
+                                            : " sequential");
+      Measure("ParticleSystem::Update", parameter, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          particles.Update(1e-6f);
+        }
+      });
+    }
+  }
+}
+
+// --- Audio -------------------------------------------------------------------
+
+void BenchAudio() {
+  Measure("SoundBank::Synthesize", "44100Hz stereo", [](long n) {
+    for (long i = 0; i < n; ++i) {
+      SoundBank const bank = SoundBank::Synthesize(44100, 2);
+      sink = sink + bank.Samples(SoundBank::Sound::kEat)[1000];
+    }
+  });
+
+  std::string const cache_path = "snake_bench_sounds.bank";
+  SoundBank::Synthesize(44100, 2).SaveCache(cache_path);
+  Measure("SoundBank::LoadCache", "44100Hz stereo", [&](long n) {
+    for (long i = 0; i < n; ++i) {
+      SoundBank bank;
+      sink = sink + bank.LoadCache(cache_path, 44100, 2);
+    }
+  });
+  std::remove(cache_path.c_str());
+
+  // One 1024-frame stereo callback with every voice busy, restarting the
+  // game-over sound whenever the pool drains.
+  SoundBank const bank = SoundBank::Synthesize(44100, 2);
+  AudioMixer mixer;
+  mixer.SetBank(&bank);
+  std::vector<std::int16_t> stream(2048);
+  Measure("AudioMixer::Mix", "8 voices 1024 frames", [&](long n) {
+    for (long i = 0; i < n; ++i) {
+      if (i % 32 == 0) {
+        for (int v = 0; v < AudioMixer::kVoiceCount; ++v) {
+          mixer.Play(SoundBank::Sound::kGameOver);
+          std::fill(stream.begin(), stream.end(), 0);
+          mixer.Mix(stream.data(), 0);
+        }
+      }
+      std::fill(stream.begin(), stream.end(), 0);
+      mixer.Mix(stream.data(), stream.size());
+    }
+    sink = sink + stream[100];
+  });
+}
+
+// --- Audio latency mode ------------------------------------------------------
+
+std::uint32_t Percentile(std::vector<std::uint32_t> values, double fraction) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::size_t const rank = std::min(
+      values.size() - 1, static_cast<std::size_t>(fraction * values.size()));
+  std::nth_element(values.begin(), values.begin() + rank, values.end());
+  return values[rank];
+}
+
+void BenchAudioLatency(std::string const &driver, double seconds) {
+  SDL_setenv("SDL_AUDIODRIVER", driver.c_str(), 1);
+  // The disk driver paces its callbacks like a device; discard the output.
+#if defined(_WIN32)
+  SDL_setenv("SDL_DISKAUDIOFILE", "NUL", 0);
+#else
+  SDL_setenv("SDL_DISKAUDIOFILE", "/dev/null", 0);
+#endif
+  constexpr int kSampleRate{44100};
+
+  std::printf("Audio latency on the '%s' driver, %d Hz, %.1f s per buffer size\n",
+              driver.c_str(), kSampleRate, seconds);
+  std::printf("%8s %9s | %-26s | %-20s | %s\n", "buffer", "period", "play-to-callback p50/p99/max",
+              "callback CPU p50/p99", "underruns");
+  for (int buffer : {128, 256, 512, 1024, 2048, 4096}) {
+    AudioManager audio;
+    audio.EnableTelemetry(true);
+    if (!audio.Initialize(AudioSettings{kSampleRate, buffer})) {
+      std::cerr << "Skipping buffer " << buffer << ": audio device did not open.\n";
+      continue;
+    }
+    auto const load_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!audio.SoundsReady() && std::chrono::steady_clock::now() < load_deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Eat sounds at irregular intervals, as in play
+    std::mt19937 rng(static_cast<unsigned>(buffer));
+    std::uniform_int_distribution<int> gap_ms(5, 40);
+    auto const end = std::chrono::steady_clock::now() +
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double>(seconds));
+    while (std::chrono::steady_clock::now() < end) {
+      audio.PlayEatSound();
+      std::this_thread::sleep_for(std::chrono::milliseconds(gap_ms(rng)));
+    }
+    audio.Cleanup();
+
+    AudioMixer::Telemetry const &telemetry = *audio.GetTelemetry();
+    std::vector<std::uint32_t> latency(telemetry.start_latency_us.begin(),
+                                       telemetry.start_latency_us.begin() + telemetry.starts);
+    std::vector<std::uint32_t> cpu(telemetry.callback_us.begin(),
+                                   telemetry.callback_us.begin() + telemetry.callbacks);
+    double const period_us = buffer * 1e6 / kSampleRate;
+    std::size_t underruns = 0;
+    for (std::size_t i = 1; i < telemetry.callbacks; ++i) {
+      underruns += telemetry.interval_us[i] > 1.5 * period_us ? 1 : 0;
+    }
+
+    std::printf("%8d %7.1fms | %7.2f %7.2f %7.2f ms   | %6u %6u us        | %zu of %zu\n",
+                buffer, period_us / 1000.0, Percentile(latency, 0.5) / 1000.0,
+                Percentile(latency, 0.99) / 1000.0, Percentile(latency, 1.0) / 1000.0,
+                Percentile(cpu, 0.5), Percentile(cpu, 0.99), underruns, telemetry.callbacks);
+
+    std::string const parameter = "buffer=" + std::to_string(buffer);
+    results.push_back({"Audio play-to-callback p50", parameter, static_cast<long>(latency.size()),
+                       Percentile(latency, 0.5) * 1000.0});
+    results.push_back({"Audio play-to-callback p99", parameter, static_cast<long>(latency.size()),
+                       Percentile(latency, 0.99) * 1000.0});
+    results.push_back({"Audio callback CPU p99", parameter, static_cast<long>(cpu.size()),
+                       Percentile(cpu, 0.99) * 1000.0});
+    results.push_back({"Audio underruns", parameter + " (count)",
+                       static_cast<long>(telemetry.callbacks), static_cast<double>(underruns)});
+  }
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+}
+
+// --- Renderer ----------------------------------------------------------------
+
+void BenchRenderer() {
+  // Headless software rendering so the numbers reflect CPU work only.
+  SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+  SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  Renderer renderer(640, 640, 32, 32);
+  SDL_Renderer *target = RendererBenchAccess::Target(renderer);
+  if (target == nullptr) {
+    std::cerr << "Skipping renderer benchmarks: no renderer available.\n";
+    return;
+  }
+
+  // SDL queues draw commands; flush so each batch pays for its rasterising.
+  auto timed = [&](std::string const &name, std::string const &parameter,
+                   std::function<void()> const &draw) {
+    Measure(name, parameter, [&](long n) {
+      for (long i = 0; i < n; ++i) {
+        draw();
+      }
+      RendererBenchAccess::Flush(renderer);
+      SDL_RenderFlush(target);
+    });
+  };
+
+  for (int radius : {5, 10, 20}) {
+    timed("Renderer::DrawCircle", "r=" + std::to_string(radius),
+          [&] { RendererBenchAccess::DrawCircle(renderer, radius); });
+  }
+  timed("Renderer::RenderRoundedRect", "16x16 r=3",
+        [&] { RendererBenchAccess::RoundedRect(renderer, 16, 16, 3); });
+  timed("Renderer::RenderRoundedRect", "350x250 r=15",
+        [&] { RendererBenchAccess::RoundedRect(renderer, 350, 250, 15); });
+  timed("Renderer::RenderBitmapText", "SCORE: 1234",
+        [&] { RendererBenchAccess::BitmapText(renderer, "SCORE: 1234"); });
+  timed("Renderer::RenderBitmapText", "PRESS SPACE TO RESUME", [&] {
+    RendererBenchAccess::BitmapText(renderer, "PRESS SPACE TO RESUME");
+  });
+  timed("BitmapFont::DrawText", "PRESS SPACE TO RESUME", [&] {
+    RendererBenchAccess::GlyphText(renderer, "PRESS SPACE TO RESUME");
+  });
+  timed("Renderer::RenderGradientBackground", "640x640 cached",
+        [&] { RendererBenchAccess::GradientBackground(renderer); });
+  timed("Renderer::RenderGradientBackground", "640x640 rebuild",
+        [&] { RendererBenchAccess::RebuildBackground(renderer); });
+  timed("Renderer::RenderGameOverScreen", "cached",
+        [&] { RendererBenchAccess::GameOverScreen(renderer, 1234); });
+  int final_score = 0;
+  timed("Renderer::RenderGameOverScreen", "new score", [&] {
+    RendererBenchAccess::GameOverScreen(renderer, ++final_score);
+  });
+
+  // Whole playing frames: the number of geometry submissions should stay
+  // flat as the snake and the particle count grow.
+  for (int length : {16, 256, 1000}) {
+    RenderSnapshot snapshot;
+    snapshot.state = GameState::Playing;
+    for (int i = 0; i < length; ++i) {
+      int const row = i / 32;
+      int const column = row % 2 == 0 ? i % 32 : 31 - i % 32;
+      snapshot.body.push_back(Point{column, row});
+    }
+    snapshot.body_end_seq = length;
+    snapshot.head_x = snapshot.prev_head_x = 0.0f;
+    snapshot.head_y = snapshot.prev_head_y = 31.0f;
+    snapshot.food = Point{5, 31};
+    for (int i = 0; i < length / 4; ++i) {
+      renderer.EmitFoodParticles(static_cast<float>(i % 32), 16.0f);
+    }
+
+    RendererBenchAccess::ResetStats(renderer);
+    renderer.Render(snapshot, 0.5f, 0.0f);
+    RendererBenchAccess::Flush(renderer);
+    std::size_t const draws = RendererBenchAccess::DrawCalls(renderer);
+    timed("Renderer::Render", "len=" + std::to_string(length) +
+                                  " draws=" + std::to_string(draws),
+          [&] { renderer.Render(snapshot, 0.5f, 0.0f); });
+    renderer.UpdateParticles(10.0f);  // Expire this case's particles
+  }
+
+  // A snake that moves one cell per frame along a serpentine over the
+  // 32x32 board: the snake layer repaints a handful of cells per frame
+  // whatever the length.
+  auto serpentine = [](std::uint64_t step) {
+    int const index = static_cast<int>(step % 1024);
+    int const row = index / 32;
+    return Point{row % 2 == 0 ? index % 32 : 31 - index % 32, row};
+  };
+  for (int length : {16, 256, 1000}) {
+    RenderSnapshot moving;
+    moving.state = GameState::Playing;
+    moving.food = Point{5, 31};
+    std::uint64_t step = 0;
+    auto advance = [&] {
+      ++step;
+      moving.body.clear();
+      for (std::uint64_t seq = step; seq < step + length; ++seq) {
+        moving.body.push_back(serpentine(seq));
+      }
+      moving.body_end_seq = step + length;
+      Point const head = serpentine(step + length);
+      moving.head_x = moving.prev_head_x = static_cast<float>(head.x);
+      moving.head_y = moving.prev_head_y = static_cast<float>(head.y);
+    };
+    advance();
+    renderer.Render(moving, 0.5f, 0.0f);
+    timed("Renderer::Render (moving)", "len=" + std::to_string(length), [&] {
+      advance();
+      renderer.Render(moving, 0.5f, 0.0f);
+    });
+  }
+
+  // Fireworks mode frames: particle update plus the whole render.
+  renderer.SetFireworksMode(true);
+  RenderSnapshot playing;
+  playing.state = GameState::Playing;
+  playing.body.push_back(Point{10, 10});
+  playing.head_x = playing.prev_head_x = 11.0f;
+  playing.head_y = playing.prev_head_y = 10.0f;
+  for (int count : {10000, 100000, 1000000}) {
+    ParticleSystem &particles = RendererBenchAccess::Particles(renderer);
+    particles.Clear();
+    particles.EmitFireworkParticles(16.0f, 16.0f, count);
+    timed("Renderer frame (fireworks)", std::to_string(count) + " particles", [&] {
+      renderer.UpdateParticles(1e-6f);
+      renderer.Render(playing, 0.5f, 0.0f);
+    });
+  }
+  RendererBenchAccess::Particles(renderer).Clear();
+}
+
+// The whole body drawn as straight runs: a serpentine over a 128-wide
+// board turns once per row, so the quad count follows the number of rows
+// and gradient bands rather than the length.
+void BenchSnakeRuns() {
+  constexpr int kBoard{128};
+  Renderer renderer(640, 640, kBoard, kBoard);
+  SDL_Renderer *target = RendererBenchAccess::Target(renderer);
+  if (target == nullptr) {
+    std::cerr << "Skipping snake run benchmarks: no renderer available.\n";
+    return;
+  }
+  for (int length : {1000, 10000}) {
+    RenderSnapshot snapshot;
+    for (int i = 0; i < length; ++i) {
+      int const row = i / kBoard;
+      snapshot.body.push_back(
+          Point{row % 2 == 0 ? i % kBoard : kBoard - 1 - i % kBoard, row});
+    }
+    snapshot.body_end_seq = length;
+
+    RendererBenchAccess::ResetStats(renderer);
+    RendererBenchAccess::SnakeBody(renderer, snapshot);
+    std::size_t const quads = RendererBenchAccess::Quads(renderer);
+    Measure("Renderer snake body (runs)",
+            "len=" + std::to_string(length) + " quads=" + std::to_string(quads),
+            [&](long n) {
+              for (long i = 0; i < n; ++i) {
+                RendererBenchAccess::SnakeBody(renderer, snapshot);
+              }
+              RendererBenchAccess::Flush(renderer);
+              SDL_RenderFlush(target);
+            });
+  }
+  RendererBenchAccess::Flush(renderer);
+}
+
+// Frames through the scrolling camera: the same 64K-segment snake on ever
+// larger boards, up to the largest the game accepts. Only the cells under
+// the 640x640 view are drawn, so the time and the draw count should not
+// grow with the board.
+void BenchLargeBoards() {
+  constexpr int kLength{65536};
+  for (int board : {512, 2048, static_cast<int>(kMaxGridSide)}) {
+    // One renderer at a time: each owns SDL's init and quit
+    Renderer renderer(640, 640, board, board);
+    SDL_Renderer *target = RendererBenchAccess::Target(renderer);
+    if (target == nullptr) {
+      std::cerr << "Skipping large board benchmarks: no renderer available.\n";
+      return;
+    }
+
+    auto serpentine = [board](int index) {
+      int const row = index / board;
+      return Point{row % 2 == 0 ? index % board : board - 1 - index % board, row};
+    };
+    RenderSnapshot snapshot;
+    snapshot.state = GameState::Playing;
+    for (int i = 0; i < kLength; ++i) {
+      snapshot.body.push_back(serpentine(i));
+    }
+    snapshot.body_end_seq = kLength;
+    Point const head = serpentine(kLength);
+    snapshot.head_x = snapshot.prev_head_x = static_cast<float>(head.x);
+    snapshot.head_y = snapshot.prev_head_y = static_cast<float>(head.y);
+    snapshot.food = Point{head.x, head.y + 2};
+    for (int i = 0; i < 256; ++i) {
+      renderer.EmitFoodParticles(static_cast<float>(head.x), static_cast<float>(head.y));
+    }
+
+    // The first frame fills the snake map; later ones only walk the view
+    renderer.Render(snapshot, 0.5f, 0.0f);
+    RendererBenchAccess::Flush(renderer);
+    RendererBenchAccess::ResetStats(renderer);
+    renderer.Render(snapshot, 0.5f, 0.0f);
+    RendererBenchAccess::Flush(renderer);
+    std::size_t const draws = RendererBenchAccess::DrawCalls(renderer);
+    Measure("Renderer::Render (camera)",
+            "board=" + std::to_string(board) + " draws=" + std::to_string(draws),
+            [&](long n) {
+              for (long i = 0; i < n; ++i) {
+                renderer.Render(snapshot, 0.5f, 0.0f);
+              }
+              RendererBenchAccess::Flush(renderer);
+              SDL_RenderFlush(target);
+            });
+  }
+}
+
+// --- Output ----------------------------------------------------------------
+
+std::string Escape(std::string const &text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+void WriteJson(std::ostream &out) {
+  out << "{\n  \"benchmarks\": [\n";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    Result const &r = results[i];
+    out << "    {\"name\": \"" << Escape(r.name) << "\", \"parameter\": \""
+        << Escape(r.parameter) << "\", \"iterations\": " << r.iterations
+        << ", \"ns_per_op\": " << r.ns_per_op << "}"
+        << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::string out_path = "snake_bench.json";
+  bool audio_latency = false;
+  std::string audio_driver = "disk";
+  double audio_seconds = 3.0;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      out_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (std::strcmp(argv[i], "--audio-latency") == 0) {
+      audio_latency = true;
+    } else if (std::strcmp(argv[i], "--audio-driver") == 0 && i + 1 < argc) {
+      audio_driver = argv[++i];
+    } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      audio_seconds = std::atof(argv[++i]);
+    } else {
+      std::cerr << "Usage: snake_bench [--out results.json] [--filter text]\n"
+                   "       snake_bench --audio-latency [--audio-driver NAME] "
+                   "[--seconds S] [--out results.json]\n";
+      return 1;
+    }
+  }
+
+  if (audio_latency) {
+    BenchAudioLatency(audio_driver, audio_seconds);
+  } else {
+    BenchSimulation();
+    BenchParticles();
+    BenchAudio();
+    BenchRenderer();
+    BenchSnakeRuns();
+    BenchLargeBoards();
+  }
+
+  std::ofstream out(out_path);
+  if (!out) {
+    std::cerr << "Could not write " << out_path << "\n";
+    return 1;
+  }
+  WriteJson(out);
+  std::cout << "Wrote " << results.size() << " results to " << out_path << "\n";
+  return 0;
+}
@@ -19,8 +19,7 @@
 
 #include "audio.h"
 #include <iostream>
-#include <cmath>
-#include <vector>
+#include <string>
 
 AudioManager::AudioManager() : initialized(false) {
 }
@@ -29,131 +28,80 @@ AudioManager::~AudioManager() {
     Cleanup();
 }
 
-bool AudioManager::Initialize() {
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
+bool AudioManager::Initialize(AudioSettings const& settings) {
+    if (Mix_OpenAudio(settings.sample_rate, MIX_DEFAULT_FORMAT, 2, settings.buffer_frames) < 0) {
         std::cerr << "SDL_mixer could not initialize! SDL_mixer Error: " << Mix_GetError() << std::endl;
         return false;
     }
     
+    // The device may have been opened at a different rate or channel count;
+    // the sound bank is rendered to match.
+    int frequency = settings.sample_rate;
+    Uint16 format = MIX_DEFAULT_FORMAT;
+    int channels = 2;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    if (format != AUDIO_S16SYS) {
+        std::cerr << "Unsupported audio format; sound disabled." << std::endl;
+        Mix_CloseAudio();
+        return false;
+    }
+    
+    // All sound effects go through our own mixer in the post-mix hook;
+    // SDL_mixer's channels are not used.
+    Mix_AllocateChannels(0);
+    Mix_SetPostMix(MixCallback, this);
+    
     initialized = true;
-    GenerateSounds(); // Create sound effects programmatically
+    StartLoadingSounds(frequency, channels);
     return true;
 }
 
 void AudioManager::Cleanup() {
-    if (!initialized) return;
-    
-    // Free all loaded sounds
-    for (auto& pair : sounds) {
-        if (pair.second) {
-            Mix_FreeChunk(pair.second);
-        }
+    if (loader.joinable()) {
+        loader.join();
     }
-    sounds.clear();
+    if (!initialized) return;
     
+    Mix_SetPostMix(nullptr, nullptr);
     Mix_CloseAudio();
+    mixer.SetBank(nullptr);
+    mixer.Reset();
+    bank.reset();
     initialized = false;
 }
 
-bool AudioManager::LoadSound(const std::string& name, const std::string& filename) {
-    if (!initialized) return false;
-    
-    Mix_Chunk* chunk = Mix_LoadWAV(filename.c_str());
-    if (!chunk) {
-        std::cerr << "Failed to load sound " << filename << "! SDL_mixer Error: " << Mix_GetError() << std::endl;
-        return false;
-    }
-    
-    sounds[name] = chunk;
-    return true;
-}
-
-void AudioManager::PlaySound(const std::string& name) {
+void AudioManager::PlaySound(SoundId sound) {
     if (!initialized) return;
     
-    auto it = sounds.find(name);
-    if (it != sounds.end() && it->second) {
-        Mix_PlayChannel(-1, it->second, 0);
-    }
+    // A full ring means the audio thread is stalled; dropping is harmless
+    mixer.Play(sound);
 }
 
 void AudioManager::PlayEatSound() {
-    PlaySound("eat");
+    PlaySound(SoundId::kEat);
 }
 
 void AudioManager::PlayGameOverSound() {
-    PlaySound("gameover");
+    PlaySound(SoundId::kGameOver);
 }
 
-void AudioManager::GenerateSounds() {
-    // Generate eating sound - pleasant chime
-    Mix_Chunk* eatSound = GenerateBeepSound(800, 200, 100);
-    if (eatSound) {
-        sounds["eat"] = eatSound;
-    }
-    
-    // Generate game over sound - descending tone
-    std::vector<Sint16> gameOverSamples;
-    int sampleRate = 44100;
-    int duration = 800; // 0.8 seconds
-    int totalSamples = (sampleRate * duration) / 1000;
-    
-    for (int i = 0; i < totalSamples; ++i) {
-        float t = static_cast<float>(i) / sampleRate;
-        float frequency = 400.0f - (200.0f * t); // Descending from 400Hz to 200Hz
-        float amplitude = 8000.0f * (1.0f - t); // Fading out
-        
-        Sint16 sample = static_cast<Sint16>(amplitude * sin(2.0f * M_PI * frequency * t));
-        gameOverSamples.push_back(sample);
-        gameOverSamples.push_back(sample); // Stereo (duplicate for both channels)
+void AudioManager::StartLoadingSounds(int sample_rate, int channels) {
+    // Cache the rendered bank in the per-user data directory
+    std::string cache_path;
+    if (char* pref_path = SDL_GetPrefPath("SnakeGame-C", "SnakeGame-C")) {
+        cache_path = std::string(pref_path) + "sounds.bank";
+        SDL_free(pref_path);
     }
     
-    // Create SDL chunk from samples
-    Mix_Chunk* gameOverChunk = static_cast<Mix_Chunk*>(malloc(sizeof(Mix_Chunk)));
-    gameOverChunk->allocated = 1;
-    gameOverChunk->alen = gameOverSamples.size() * sizeof(Sint16);
-    gameOverChunk->abuf = static_cast<Uint8*>(malloc(gameOverChunk->alen));
-    gameOverChunk->volume = MIX_MAX_VOLUME;
-    
-    memcpy(gameOverChunk->abuf, gameOverSamples.data(), gameOverChunk->alen);
-    sounds["gameover"] = gameOverChunk;
+    loader = std::thread([this, cache_path, sample_rate, channels] {
+        bank = std::make_unique<SoundBank>(
+            SoundBank::LoadOrSynthesize(cache_path, sample_rate, channels));
+        mixer.SetBank(bank.get());
+    });
 }
 
-Mix_Chunk* AudioManager::GenerateBeepSound(int frequency, int duration_ms, int volume) {
-    int sampleRate = 44100;
-    int totalSamples = (sampleRate * duration_ms) / 1000;
-    
-    std::vector<Sint16> samples;
-    samples.reserve(totalSamples * 2); // Stereo
-    
-    for (int i = 0; i < totalSamples; ++i) {
-        float t = static_cast<float>(i) / sampleRate;
-        float amplitude = volume * 60.0f; // Scale volume
-        
-        // Add envelope for smooth start/end
-        float envelope = 1.0f;
-        if (i < totalSamples * 0.1) {
-            envelope = static_cast<float>(i) / (totalSamples * 0.1f); // Fade in
-        } else if (i > totalSamples * 0.9) {
-            envelope = 1.0f - static_cast<float>(i - totalSamples * 0.9f) / (totalSamples * 0.1f); // Fade out
-        }
-        
-        Sint16 sample = static_cast<Sint16>(amplitude * envelope * sin(2.0f * M_PI * frequency * t));
-        samples.push_back(sample);
-        samples.push_back(sample); // Stereo
-    }
-    
-    // Create SDL chunk
-    Mix_Chunk* chunk = static_cast<Mix_Chunk*>(malloc(sizeof(Mix_Chunk)));
-    chunk->allocated = 1;
-    chunk->alen = samples.size() * sizeof(Sint16);
-    chunk->abuf = static_cast<Uint8*>(malloc(chunk->alen));
-    chunk->volume = MIX_MAX_VOLUME;
-    
-    memcpy(chunk->abuf, samples.data(), chunk->alen);
-    return chunk;
+void AudioManager::MixCallback(void* userdata, Uint8* stream, int length) {
+    AudioManager* self = static_cast<AudioManager*>(userdata);
+    self->mixer.Mix(reinterpret_cast<std::int16_t*>(stream),
+                    static_cast<std::size_t>(length) / sizeof(std::int16_t));
 }
-
-Mix_Chunk* AudioManager::GenerateClickSound(int volume) {
-    return GenerateBeepSound(1200, 50, volume);
-}
\ No newline at end of file
@@ -27,35 +27,59 @@
 #define AUDIO_H
 
 #include "SDL_mixer.h"
-#include <string>
-#include <map>
+#include "audio_mixer.h"
+#include "sound_bank.h"
+#include <memory>
+#include <thread>
+
+// Compile-time identifiers of the game's sound effects.
+using SoundId = SoundBank::Sound;
+
+// Output device parameters. A sound reaches the speakers up to about
+// buffer_frames / sample_rate seconds after it is mixed, so smaller
+// buffers cut latency at the cost of more frequent callbacks.
+struct AudioSettings {
+    int sample_rate{44100};
+    int buffer_frames{2048};
+};
 
 class AudioManager {
 public:
     AudioManager();
     ~AudioManager();
     
-    bool Initialize();
+    // Opens the audio device and starts loading the sound bank on a
+    // background thread; returns without waiting for it.
+    bool Initialize(AudioSettings const& settings = AudioSettings{});
     void Cleanup();
     
-    // Load sounds
-    bool LoadSound(const std::string& name, const std::string& filename);
-    
-    // Play sounds
-    void PlaySound(const std::string& name);
+    // Play sounds. Only queues a command for the audio thread: no locks, no
+    // allocation. Sounds requested before the bank has finished loading
+    // are skipped.
+    void PlaySound(SoundId sound);
     void PlayEatSound();
     void PlayGameOverSound();
     
-    // Generate simple sound effects programmatically
-    void GenerateSounds();
+    // True once the sound bank has loaded and sounds are audible.
+    bool SoundsReady() const { return mixer.HasBank(); }
+    
+    // Mixer timing telemetry (see AudioMixer::Telemetry). Enable before
+    // Initialize(); read after Cleanup().
+    void EnableTelemetry(bool enabled) { mixer.EnableTelemetry(enabled); }
+    AudioMixer::Telemetry const* GetTelemetry() const { return mixer.GetTelemetry(); }
     
 private:
     bool initialized;
-    std::map<std::string, Mix_Chunk*> sounds;
     
-    // Helper methods for sound generation
-    Mix_Chunk* GenerateBeepSound(int frequency, int duration_ms, int volume = 128);
-    Mix_Chunk* GenerateClickSound(int volume = 64);
+    // Procedural sound effects, mapped from the disk cache or synthesized
+    // by `loader`, then handed to the mixer.
+    std::unique_ptr<SoundBank> bank;
+    std::thread loader;
+    AudioMixer mixer;
+
+    void StartLoadingSounds(int sample_rate, int channels);
+    // SDL_mixer post-mix hook; runs on the audio thread.
+    static void MixCallback(void* userdata, Uint8* stream, int length);
 };
 
-#endif
\ No newline at end of file
+#endif
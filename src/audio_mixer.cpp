@@ -0,0 +1,154 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Lock-Free Sound Effect Mixer Implementation
+ * ============================================================================
+ *
+ * File: audio_mixer.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "audio_mixer.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+// Samples mixed per pass through the 32-bit accumulator.
+constexpr std::size_t kMixBlock{1024};
+
+std::int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+std::uint32_t ToMicroseconds(std::int64_t ns) {
+    return static_cast<std::uint32_t>(std::max<std::int64_t>(0, ns) / 1000);
+}
+
+}  // namespace
+
+int AudioMixer::Priority(SoundBank::Sound sound) {
+    switch (sound) {
+        case SoundBank::Sound::kGameOver:
+            return 2;
+        case SoundBank::Sound::kEat:
+            return 1;
+    }
+    return 0;
+}
+
+bool AudioMixer::Play(SoundBank::Sound sound) {
+    std::int64_t const queued_ns =
+        telemetry_enabled.load(std::memory_order_relaxed) ? NowNs() : 0;
+    return commands.Push(Command{sound, queued_ns});
+}
+
+void AudioMixer::EnableTelemetry(bool enabled) {
+    if (enabled) {
+        telemetry_data = std::make_unique<Telemetry>();
+        last_callback_ns = 0;
+    }
+    telemetry_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AudioMixer::Mix(std::int16_t* stream, std::size_t samples) {
+    Telemetry* const stats =
+        telemetry_enabled.load(std::memory_order_relaxed) ? telemetry_data.get() : nullptr;
+    std::int64_t const callback_start_ns = stats != nullptr ? NowNs() : 0;
+
+    SoundBank const* bank = current_bank.load(std::memory_order_acquire);
+    std::uint64_t const first_new_start = start_count;
+    Command command;
+    while (commands.Pop(command)) {
+        if (bank == nullptr) {
+            continue;  // Still loading; skip rather than wait
+        }
+        // Identical in-phase copies would only add clipping, so a sound
+        // starts at most once per callback.
+        bool const already_started = std::any_of(
+            voices.begin(), voices.end(), [&](Voice const& voice) {
+                return voice.active && voice.started >= first_new_start &&
+                       voice.samples == bank->Samples(command.sound);
+            });
+        if (!already_started && StartVoice(*bank, command.sound) && stats != nullptr &&
+            stats->starts < Telemetry::kCapacity) {
+            stats->start_latency_us[stats->starts++] =
+                ToMicroseconds(callback_start_ns - command.queued_ns);
+        }
+    }
+
+    std::int32_t accumulator[kMixBlock];
+    for (std::size_t base = 0; base < samples; base += kMixBlock) {
+        std::size_t const block = std::min(kMixBlock, samples - base);
+        std::int16_t* out = stream + base;
+        for (std::size_t i = 0; i < block; ++i) {
+            accumulator[i] = out[i];
+        }
+        for (Voice& voice : voices) {
+            if (!voice.active) {
+                continue;
+            }
+            std::size_t const run = std::min(block, voice.count - voice.position);
+            std::int16_t const* source = voice.samples + voice.position;
+            for (std::size_t i = 0; i < run; ++i) {
+                accumulator[i] += source[i];
+            }
+            voice.position += run;
+            voice.active = voice.position < voice.count;
+        }
+        for (std::size_t i = 0; i < block; ++i) {
+            out[i] = static_cast<std::int16_t>(std::clamp(accumulator[i], -32768, 32767));
+        }
+    }
+
+    if (stats != nullptr && stats->callbacks < Telemetry::kCapacity) {
+        std::size_t const n = stats->callbacks++;
+        stats->callback_us[n] = ToMicroseconds(NowNs() - callback_start_ns);
+        stats->interval_us[n] =
+            last_callback_ns != 0 ? ToMicroseconds(callback_start_ns - last_callback_ns) : 0;
+    }
+    last_callback_ns = callback_start_ns;
+}
+
+void AudioMixer::Reset() {
+    Command command;
+    while (commands.Pop(command)) {
+    }
+    for (Voice& voice : voices) {
+        voice.active = false;
+    }
+}
+
+bool AudioMixer::StartVoice(SoundBank const& bank, SoundBank::Sound sound) {
+    int const priority = Priority(sound);
+
+    // A free voice, else the lowest-priority voice, oldest first
+    Voice* target = nullptr;
+    for (Voice& voice : voices) {
+        if (!voice.active) {
+            target = &voice;
+            break;
+        }
+        if (target == nullptr || voice.priority < target->priority ||
+            (voice.priority == target->priority && voice.started < target->started)) {
+            target = &voice;
+        }
+    }
+    if (target->active && target->priority > priority) {
+        return false;  // Every voice is playing something more important
+    }
+
+    target->samples = bank.Samples(sound);
+    target->count = bank.SampleCount(sound);
+    target->position = 0;
+    target->started = start_count++;
+    target->priority = priority;
+    target->active = target->count > 0;
+    return true;
+}
@@ -0,0 +1,114 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Lock-Free Sound Effect Mixer
+ * ============================================================================
+ *
+ * File: audio_mixer.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * Mixes the game's sound effects on the audio thread. The game thread only
+ * pushes small play commands into a lock-free single-producer ring, so it
+ * never takes the audio device lock and never allocates. The audio
+ * callback drains the ring and mixes a fixed pool of voices into the
+ * output stream.
+ *
+ * When every voice is busy, a new sound takes over the voice with the
+ * lowest priority, the oldest one among equals, provided that voice's
+ * priority is not higher than its own. Otherwise the new sound is dropped.
+ * However many sounds are requested in a tick, the mixing work is capped
+ * at kVoiceCount voices.
+ *
+ * SDL-free: the front end calls Mix() from its SDL_mixer post-mix hook.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "sound_bank.h"
+#include "spsc_queue.h"
+
+class AudioMixer {
+public:
+    static constexpr int kVoiceCount{8};
+    static constexpr std::size_t kQueueCapacity{64};
+
+    // Timing samples recorded by the audio thread when telemetry is on.
+    // The first kCapacity of each are kept. Read them only after the audio
+    // callback has stopped.
+    struct Telemetry {
+        static constexpr std::size_t kCapacity{8192};
+        // Play() until the callback that starts the voice, in microseconds.
+        std::array<std::uint32_t, kCapacity> start_latency_us{};
+        // Time spent in Mix() and between consecutive Mix() calls.
+        std::array<std::uint32_t, kCapacity> callback_us{};
+        std::array<std::uint32_t, kCapacity> interval_us{};
+        std::size_t starts{0};
+        std::size_t callbacks{0};
+    };
+
+    // Game thread. Returns false if the command ring is full.
+    bool Play(SoundBank::Sound sound);
+
+    // Makes `bank` (or nothing) available to the audio thread. Sounds
+    // played while no bank is set are skipped.
+    void SetBank(SoundBank const* bank) { current_bank.store(bank, std::memory_order_release); }
+    bool HasBank() const { return current_bank.load(std::memory_order_acquire) != nullptr; }
+
+    // Audio thread: starts queued sounds, then adds every active voice into
+    // `stream` (`samples` interleaved 16-bit samples in the bank's format),
+    // saturating at full scale.
+    void Mix(std::int16_t* stream, std::size_t samples);
+
+    // Silences every voice and discards queued commands. Only call while
+    // the audio callback is not running.
+    void Reset();
+
+    // Starts or stops recording into GetTelemetry(). Only call while the
+    // audio callback is not running.
+    void EnableTelemetry(bool enabled);
+    Telemetry const* GetTelemetry() const { return telemetry_data.get(); }
+
+    // Higher priorities steal voices from lower ones.
+    static int Priority(SoundBank::Sound sound);
+
+private:
+    struct Command {
+        SoundBank::Sound sound;
+        std::int64_t queued_ns;  // Steady clock; 0 unless telemetry is on
+    };
+
+    struct Voice {
+        std::int16_t const* samples{nullptr};
+        std::size_t count{0};
+        std::size_t position{0};
+        std::uint64_t started{0};  // Start order, for picking the oldest
+        int priority{0};
+        bool active{false};
+    };
+
+    bool StartVoice(SoundBank const& bank, SoundBank::Sound sound);
+
+    SpscQueue<Command, kQueueCapacity> commands;
+    std::atomic<SoundBank const*> current_bank{nullptr};
+
+    // Audio thread only.
+    std::array<Voice, kVoiceCount> voices{};
+    std::uint64_t start_count{0};
+    std::int64_t last_callback_ns{0};
+
+    std::unique_ptr<Telemetry> telemetry_data;
+    std::atomic<bool> telemetry_enabled{false};
+};
+
+#endif
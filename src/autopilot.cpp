@@ -0,0 +1,88 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Autopilot Bot Implementation
+ * ============================================================================
+ * 
+ * File: autopilot.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "autopilot.h"
+#include <cstdlib>
+#include <limits>
+
+namespace {
+
+// Distance along one wrapping axis.
+int WrapDistance(int from, int to, int extent) {
+  int d = std::abs(to - from);
+  return d < extent - d ? d : extent - d;
+}
+
+bool IsReverse(Snake::Direction a, Snake::Direction b) {
+  switch (a) {
+    case Snake::Direction::kUp:
+      return b == Snake::Direction::kDown;
+    case Snake::Direction::kDown:
+      return b == Snake::Direction::kUp;
+    case Snake::Direction::kLeft:
+      return b == Snake::Direction::kRight;
+    case Snake::Direction::kRight:
+      return b == Snake::Direction::kLeft;
+  }
+  return false;
+}
+
+}  // namespace
+
+void Autopilot::Steer(Simulation &simulation) {
+  Snake &snake = simulation.GetSnake();
+  Point const &food = simulation.GetFood();
+  int const width = simulation.GridWidth();
+  int const height = simulation.GridHeight();
+  int const head_x = static_cast<int>(snake.head_x);
+  int const head_y = static_cast<int>(snake.head_y);
+
+  constexpr Snake::Direction kDirections[] = {
+      Snake::Direction::kUp, Snake::Direction::kDown, Snake::Direction::kLeft,
+      Snake::Direction::kRight};
+
+  Snake::Direction best = snake.direction;
+  int best_distance = std::numeric_limits<int>::max();
+  for (Snake::Direction candidate : kDirections) {
+    if (snake.size > 1 && IsReverse(snake.direction, candidate)) {
+      continue;
+    }
+    int x = head_x;
+    int y = head_y;
+    switch (candidate) {
+      case Snake::Direction::kUp:
+        y = (y + height - 1) % height;
+        break;
+      case Snake::Direction::kDown:
+        y = (y + 1) % height;
+        break;
+      case Snake::Direction::kLeft:
+        x = (x + width - 1) % width;
+        break;
+      case Snake::Direction::kRight:
+        x = (x + 1) % width;
+        break;
+    }
+    if (snake.SnakeCell(x, y)) {
+      continue;
+    }
+    int distance = WrapDistance(x, food.x, width) +
+                   WrapDistance(y, food.y, height);
+    if (distance < best_distance) {
+      best_distance = distance;
+      best = candidate;
+    }
+  }
+  snake.direction = best;
+}
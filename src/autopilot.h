@@ -0,0 +1,31 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Autopilot Bot
+ * ============================================================================
+ * 
+ * File: autopilot.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Minimal greedy player for headless runs. Each tick it turns toward the
+ * food along the wrap-around shortest path, never reverses, and avoids
+ * stepping into an occupied neighbour cell when a free one exists. It is
+ * meant to exercise the simulation, not to play well.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include "simulation.h"
+
+class Autopilot {
+ public:
+  static void Steer(Simulation &simulation);
+};
+
+#endif
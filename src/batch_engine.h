@@ -0,0 +1,68 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Batch Simulation Engine
+ * ============================================================================
+ * 
+ * File: batch_engine.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Holds many independent seeded games and advances them across all cores
+ * for bot evaluation. Games are stored contiguously and handed out to the
+ * work-stealing pool as contiguous index ranges, so a thread walks
+ * neighbouring games in memory order. Within a range each game is advanced
+ * through the whole tick block before moving on, which keeps that game's
+ * snake, occupancy map and free list cache-resident for the block instead
+ * of evicting them once per tick. Per-game tallies live in a separate
+ * packed array written only by the thread that owns the game.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef BATCH_ENGINE_H
+#define BATCH_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "simulation.h"
+#include "work_stealing_pool.h"
+
+struct BatchTotals {
+  std::uint64_t ticks{0};
+  std::uint64_t games_finished{0};
+  std::uint64_t score{0};
+};
+
+class BatchEngine {
+ public:
+  // Game i is seeded from base_seed and i, so results do not depend on the
+  // number of threads or on scheduling.
+  BatchEngine(std::size_t game_count, int grid_width, int grid_height,
+              std::uint64_t base_seed);
+
+  // Advances every game by `ticks` ticks under the autopilot. Finished games
+  // are tallied and restarted in place.
+  void Step(WorkStealingPool &pool, int ticks);
+
+  BatchTotals Totals() const;
+  std::size_t GameCount() const { return games.size(); }
+  Simulation const &GetGame(std::size_t i) const { return games[i]; }
+
+ private:
+  struct GameTally {
+    std::uint64_t ticks;
+    std::uint32_t finished;
+    std::uint32_t score;
+  };
+
+  void StepRange(std::size_t begin, std::size_t end, int ticks);
+
+  std::vector<Simulation> games;
+  std::vector<GameTally> tallies;
+};
+
+#endif
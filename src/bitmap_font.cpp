@@ -0,0 +1,234 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Bitmap Font Glyph Atlas Implementation
+ * ============================================================================
+ *
+ * File: bitmap_font.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "bitmap_font.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+
+namespace {
+
+// One byte per row, top to bottom; bit 4 is the leftmost column.
+struct GlyphBits {
+  char code;
+  std::array<std::uint8_t, BitmapFont::kGlyphHeight> rows;
+};
+
+constexpr GlyphBits kGlyphs[] = {
+    {' ', {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {'.', {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00}},
+    {'0', {0x0E, 0x13, 0x15, 0x19, 0x19, 0x0E, 0x00}},
+    {'1', {0x04, 0x0C, 0x04, 0x04, 0x04, 0x1F, 0x00}},
+    {'2', {0x0E, 0x11, 0x02, 0x04, 0x08, 0x1F, 0x00}},
+    {'3', {0x1E, 0x01, 0x0E, 0x01, 0x01, 0x1E, 0x00}},
+    {'4', {0x12, 0x12, 0x12, 0x1F, 0x02, 0x02, 0x00}},
+    {'5', {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x1E, 0x00}},
+    {'6', {0x0E, 0x10, 0x1E, 0x11, 0x11, 0x0E, 0x00}},
+    {'7', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x00}},
+    {'8', {0x0E, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00}},
+    {'9', {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x0E, 0x00}},
+    {':', {0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00}},
+    {'A', {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00}},
+    {'B', {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x1E, 0x00}},
+    {'C', {0x0E, 0x11, 0x10, 0x10, 0x11, 0x0E, 0x00}},
+    {'D', {0x1E, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x00}},
+    {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x1F, 0x00}},
+    {'F', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x00}},
+    {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x0E, 0x00}},
+    {'H', {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00}},
+    {'I', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00}},
+    {'K', {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x00}},
+    {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x00}},
+    {'M', {0x11, 0x1B, 0x15, 0x11, 0x11, 0x11, 0x00}},
+    {'N', {0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00}},
+    {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00}},
+    {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x00}},
+    {'Q', {0x0E, 0x11, 0x11, 0x15, 0x13, 0x0F, 0x00}},
+    {'R', {0x1E, 0x11, 0x11, 0x1E, 0x12, 0x11, 0x00}},
+    {'S', {0x0F, 0x10, 0x0E, 0x01, 0x01, 0x1E, 0x00}},
+    {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00}},
+    {'U', {0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00}},
+    {'V', {0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00}},
+    {'W', {0x11, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00}},
+    {'X', {0x11, 0x0A, 0x04, 0x04, 0x0A, 0x11, 0x00}},
+    {'Y', {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x00}},
+};
+
+constexpr int kGlyphCount = static_cast<int>(sizeof(kGlyphs) / sizeof(kGlyphs[0]));
+
+// Runs not drawn for this many frames are released.
+constexpr std::uint64_t kRunIdleFrames{120};
+
+constexpr Uint32 kLit{0xFFFFFFFFu};
+
+}  // namespace
+
+BitmapFont::BitmapFont() {
+  glyph_index.fill(-1);
+  for (int i = 0; i < kGlyphCount; ++i) {
+    glyph_index[static_cast<unsigned char>(kGlyphs[i].code)] =
+        static_cast<std::int8_t>(i);
+  }
+}
+
+BitmapFont::~BitmapFont() { Release(); }
+
+void BitmapFont::Release() {
+  for (auto &entry : runs) {
+    SDL_DestroyTexture(entry.second.texture);
+  }
+  runs.clear();
+  if (atlas != nullptr) {
+    SDL_DestroyTexture(atlas);
+    atlas = nullptr;
+  }
+  renderer = nullptr;
+}
+
+void BitmapFont::Bake(SDL_Renderer *target) {
+  renderer = target;
+  if (renderer == nullptr) {
+    return;
+  }
+
+  // All glyphs side by side in one strip, each followed by its blank
+  // spacing column.
+  int const width = kGlyphCount * kAdvance;
+  atlas_width = width;
+  scratch.assign(static_cast<std::size_t>(width) * kGlyphHeight, 0);
+  for (int i = 0; i < kGlyphCount; ++i) {
+    for (int row = 0; row < kGlyphHeight; ++row) {
+      std::uint8_t const bits = kGlyphs[i].rows[row];
+      for (int col = 0; col < kGlyphWidth; ++col) {
+        if (bits & (0x10 >> col)) {
+          scratch[static_cast<std::size_t>(row) * width + i * kAdvance + col] =
+              kLit;
+        }
+      }
+    }
+  }
+
+  atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                            SDL_TEXTUREACCESS_STATIC, width, kGlyphHeight);
+  if (atlas == nullptr) {
+    std::cerr << "Glyph atlas could not be created.\n";
+    std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+    return;
+  }
+  SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+  SDL_UpdateTexture(atlas, nullptr, scratch.data(),
+                    width * static_cast<int>(sizeof(Uint32)));
+}
+
+int BitmapFont::GlyphIndex(char c) const {
+  unsigned char const upper =
+      static_cast<unsigned char>(std::toupper(static_cast<unsigned char>(c)));
+  return upper < glyph_index.size() ? glyph_index[upper] : -1;
+}
+
+void BitmapFont::DrawText(RenderBatch &batch, std::string const &text, int x,
+                          int y, int scale) {
+  if (atlas == nullptr) {
+    return;
+  }
+  // Glyphs are scaled by the quad; SDL's default nearest-pixel scaling
+  // keeps the edges sharp.
+  SDL_Rect src = {0, 0, kGlyphWidth, kGlyphHeight};
+  SDL_Rect dst = {x, y, kGlyphWidth * scale, kGlyphHeight * scale};
+  for (char c : text) {
+    int const index = GlyphIndex(c);
+    if (index >= 0 && kGlyphs[index].code != ' ') {
+      src.x = index * kAdvance;
+      batch.Copy(atlas, atlas_width, kGlyphHeight, &src, dst);
+    }
+    dst.x += kAdvance * scale;
+  }
+}
+
+void BitmapFont::DrawCachedText(RenderBatch &batch, std::string const &text,
+                                int x, int y, int scale) {
+  if (renderer == nullptr || text.empty()) {
+    return;
+  }
+  std::string key = std::to_string(scale);
+  key += ':';
+  key += text;
+
+  auto found = runs.find(key);
+  if (found == runs.end()) {
+    Run run{nullptr, 0, 0, frame};
+    run.texture = BuildRun(text, scale, run.width, run.height);
+    if (run.texture == nullptr) {
+      DrawText(batch, text, x, y, scale);
+      return;
+    }
+    found = runs.emplace(std::move(key), run).first;
+  }
+
+  Run &run = found->second;
+  run.last_used = frame;
+  SDL_Rect const dst = {x, y, run.width, run.height};
+  batch.Copy(run.texture, run.width, run.height, nullptr, dst);
+}
+
+SDL_Texture *BitmapFont::BuildRun(std::string const &text, int scale,
+                                  int &width, int &height) {
+  // Rasterize at the final scale so the run is copied 1:1.
+  width = static_cast<int>(text.size()) * kAdvance * scale;
+  height = kGlyphHeight * scale;
+  scratch.assign(static_cast<std::size_t>(width) * height, 0);
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    int const index = GlyphIndex(text[i]);
+    if (index < 0) {
+      continue;
+    }
+    int const origin_x = static_cast<int>(i) * kAdvance * scale;
+    for (int row = 0; row < kGlyphHeight; ++row) {
+      std::uint8_t const bits = kGlyphs[index].rows[row];
+      for (int col = 0; col < kGlyphWidth; ++col) {
+        if (!(bits & (0x10 >> col))) {
+          continue;
+        }
+        for (int py = row * scale; py < (row + 1) * scale; ++py) {
+          Uint32 *line = &scratch[static_cast<std::size_t>(py) * width];
+          std::fill(line + origin_x + col * scale,
+                    line + origin_x + (col + 1) * scale, kLit);
+        }
+      }
+    }
+  }
+
+  SDL_Texture *texture =
+      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                        SDL_TEXTUREACCESS_STATIC, width, height);
+  if (texture == nullptr) {
+    return nullptr;
+  }
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_UpdateTexture(texture, nullptr, scratch.data(),
+                    width * static_cast<int>(sizeof(Uint32)));
+  return texture;
+}
+
+void BitmapFont::EndFrame() {
+  ++frame;
+  for (auto it = runs.begin(); it != runs.end();) {
+    if (frame - it->second.last_used > kRunIdleFrames) {
+      SDL_DestroyTexture(it->second.texture);
+      it = runs.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
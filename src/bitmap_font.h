@@ -0,0 +1,93 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Bitmap Font Glyph Atlas
+ * ============================================================================
+ *
+ * File: bitmap_font.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * The game's 5x7 pixel font, stored as one packed bitmask byte per glyph
+ * row. At startup every glyph is baked into a small white texture atlas so
+ * a string can be drawn as one textured quad per character, all in a
+ * single batched draw.
+ *
+ * Strings that repeat from frame to frame (the score line, panel titles
+ * and instructions) go through a run cache instead: the whole string is
+ * rasterized once into its own texture and drawn with a single copy. A run
+ * is only rebuilt when its text changes, and runs that have not been drawn
+ * for a while are released.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SDL.h"
+#include "render_batch.h"
+
+class BitmapFont {
+ public:
+  static constexpr int kGlyphWidth{5};
+  static constexpr int kGlyphHeight{7};
+  static constexpr int kAdvance{kGlyphWidth + 1};  // One column of spacing
+
+  BitmapFont();
+  ~BitmapFont();
+  BitmapFont(BitmapFont const &) = delete;
+  BitmapFont &operator=(BitmapFont const &) = delete;
+
+  // Builds the glyph atlas for `renderer`. Must be called before drawing.
+  void Bake(SDL_Renderer *renderer);
+
+  // Draws `text` in white, one glyph quad per character. Lower-case is
+  // drawn upper-case; characters without a glyph leave a blank cell. Best
+  // for text that changes every frame.
+  void DrawText(RenderBatch &batch, std::string const &text, int x, int y,
+                int scale);
+  // Same output, drawn from a cached texture of the whole string. Best for
+  // text that stays the same across many frames.
+  void DrawCachedText(RenderBatch &batch, std::string const &text, int x,
+                      int y, int scale);
+
+  // Call once per presented frame; releases runs that went unused.
+  void EndFrame();
+
+  std::size_t CachedRunCount() const { return runs.size(); }
+
+  // Frees the atlas and every run; call before the SDL renderer goes away.
+  void Release();
+
+ private:
+  struct Run {
+    SDL_Texture *texture;
+    int width;
+    int height;
+    std::uint64_t last_used;
+  };
+
+  // Index of the glyph for `c` in the atlas, or -1 if the font lacks it.
+  int GlyphIndex(char c) const;
+  SDL_Texture *BuildRun(std::string const &text, int scale, int &width,
+                        int &height);
+
+  SDL_Renderer *renderer{nullptr};
+  SDL_Texture *atlas{nullptr};
+  int atlas_width{0};
+  std::array<std::int8_t, 128> glyph_index;
+
+  std::unordered_map<std::string, Run> runs;
+  std::uint64_t frame{0};
+  std::vector<Uint32> scratch;
+};
+
+#endif
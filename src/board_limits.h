@@ -0,0 +1,49 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Board and Tick Rate Limits
+ * ============================================================================
+ *
+ * File: board_limits.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * The range of board sizes and tick rates the game accepts, shared by the
+ * command lines and the replay reader so that a crafted or corrupt replay
+ * header is rejected instead of overflowing allocations or spinning the
+ * simulation thread.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef BOARD_LIMITS_H
+#define BOARD_LIMITS_H
+
+#include <cstdint>
+
+// The simulation keeps about 16 bytes per cell (the free-cell list and its
+// index, plus a body ring sized for a full board) and the renderer's
+// SnakeMap one more, so the largest board costs about 280 MB.
+constexpr long kMinGridSide{2};
+constexpr long kMaxGridSide{4096};
+constexpr long kMinTicksPerSecond{1};
+constexpr long kMaxTicksPerSecond{1000};
+
+// Both sides in range and the cell count representable as a uint32.
+inline bool ValidGridSize(long width, long height) {
+  if (width < kMinGridSide || width > kMaxGridSide ||
+      height < kMinGridSide || height > kMaxGridSide) {
+    return false;
+  }
+  return static_cast<std::uint64_t>(width) * static_cast<std::uint64_t>(height) <=
+         UINT32_MAX;
+}
+
+inline bool ValidTicksPerSecond(long ticks_per_second) {
+  return ticks_per_second >= kMinTicksPerSecond &&
+         ticks_per_second <= kMaxTicksPerSecond;
+}
+
+#endif
@@ -9,46 +9,48 @@
  * Version: 1.0.0
  * 
  * Description:
- * Implementation of the professional input handling system with
- * anti-spam protection and smooth control response.
+ * Implementation of the event-driven input queue.
  * 
  * Copyright (c) 2025 Your Name. All rights reserved.
  * ============================================================================
  */
 
 #include "controller.h"
-#include <iostream>
 #include "SDL.h"
 #include "snake.h"
 
-void Controller::ChangeDirection(Snake &snake, Snake::Direction input,
-                                 Snake::Direction opposite) {
-  Uint32 current_time = SDL_GetTicks();
-  if ((current_time - last_direction_change_time) > 100) { // Prevent too rapid direction changes
-    if (snake.direction != opposite || snake.size == 1) {
-      snake.direction = input;
-      last_direction_change_time = current_time;
-    }
+bool Controller::HandleKey(SDL_KeyboardEvent const &key, Uint64 stamp) {
+  Snake::Direction direction;
+  switch (key.keysym.sym) {
+    case SDLK_UP:
+      direction = Snake::Direction::kUp;
+      break;
+    case SDLK_DOWN:
+      direction = Snake::Direction::kDown;
+      break;
+    case SDLK_LEFT:
+      direction = Snake::Direction::kLeft;
+      break;
+    case SDLK_RIGHT:
+      direction = Snake::Direction::kRight;
+      break;
+    default:
+      return false;
   }
+  if (key.repeat == 0 && count < kCapacity) {
+    presses[(head + count) % kCapacity] = {direction, stamp};
+    ++count;
+  }
+  return true;
 }
 
-void Controller::HandleInput(bool &running, Snake &snake) {
-  const Uint8* state = SDL_GetKeyboardState(NULL);
-  
-  if (state[SDL_SCANCODE_UP]) {
-    ChangeDirection(snake, Snake::Direction::kUp,
-                    Snake::Direction::kDown);
-  }
-  else if (state[SDL_SCANCODE_DOWN]) {
-    ChangeDirection(snake, Snake::Direction::kDown,
-                    Snake::Direction::kUp);
-  }
-  else if (state[SDL_SCANCODE_LEFT]) {
-    ChangeDirection(snake, Snake::Direction::kLeft,
-                    Snake::Direction::kRight);
-  }
-  else if (state[SDL_SCANCODE_RIGHT]) {
-    ChangeDirection(snake, Snake::Direction::kRight,
-                    Snake::Direction::kLeft);
+bool Controller::PopTurn(Snake::Direction &direction, Uint64 &stamp) {
+  if (count == 0) {
+    return false;
   }
+  direction = presses[head].direction;
+  stamp = presses[head].stamp;
+  head = (head + 1) % kCapacity;
+  --count;
+  return true;
 }
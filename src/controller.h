@@ -9,9 +9,11 @@
  * Version: 1.0.0
  * 
  * Description:
- * Professional input handling system with responsive controls and
- * anti-spam protection. Features smooth directional input processing
- * with optimized timing mechanisms.
+ * Event-driven input handling. Arrow-key presses are queued as they arrive
+ * from the SDL event loop, each stamped with the high-resolution counter
+ * value of the moment the key went down, so two presses within one frame
+ * are both kept and their latency can be measured downstream. Key repeat
+ * is ignored; holding a key does not flood the queue.
  * 
  * Copyright (c) 2025 Your Name. All rights reserved.
  * ============================================================================
@@ -20,17 +22,31 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
+#include <array>
+#include <cstddef>
+#include "SDL.h"
 #include "snake.h"
 
 class Controller {
  public:
-  Controller() : last_direction_change_time(0) {}
-  void HandleInput(bool &running, Snake &snake);
+  static constexpr std::size_t kCapacity{16};
+
+  // Queues `key` if it is a fresh arrow-key press and returns true; other
+  // keys are left to the caller. `stamp` is the performance counter value
+  // when the key went down. Presses beyond kCapacity are dropped.
+  bool HandleKey(SDL_KeyboardEvent const &key, Uint64 stamp);
+  // Pops the oldest queued turn.
+  bool PopTurn(Snake::Direction &direction, Uint64 &stamp);
 
  private:
-  void ChangeDirection(Snake &snake, Snake::Direction input,
-                       Snake::Direction opposite);
-  Uint32 last_direction_change_time;
+  struct KeyPress {
+    Snake::Direction direction;
+    Uint64 stamp;
+  };
+
+  std::array<KeyPress, kCapacity> presses{};
+  std::size_t head{0};
+  std::size_t count{0};
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Per-Phase Frame Timing Statistics Implementation
+ * ============================================================================
+ * 
+ * File: frame_stats.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "frame_stats.h"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+
+// Frames between percentile refreshes (~8 per second at 240 Hz).
+constexpr std::size_t kSummaryInterval{32};
+
+float Percentile(std::vector<float> &values, float fraction) {
+  std::size_t const index = std::min(
+      values.size() - 1, static_cast<std::size_t>(fraction * values.size()));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+}  // namespace
+
+FrameStats::FrameStats() : ring(kCapacity) { scratch.reserve(kCapacity); }
+
+void FrameStats::BeginFrame() { current = Sample{}; }
+
+void FrameStats::EndFrame(float total_ms) {
+  current.total_ms = total_ms;
+  ring[next] = current;
+  next = (next + 1) % kCapacity;
+  count = std::min(count + 1, kCapacity);
+  ++frame_number;
+
+  if (++frames_since_summary >= kSummaryInterval) {
+    RefreshSummaries();
+    frames_since_summary = 0;
+  }
+}
+
+float FrameStats::RecentTotal(std::size_t i) const {
+  if (i >= count) {
+    return 0.0f;
+  }
+  return ring[(next + kCapacity - 1 - i) % kCapacity].total_ms;
+}
+
+void FrameStats::RefreshSummaries() {
+  if (count == 0) {
+    return;
+  }
+  for (std::size_t series = 0; series <= kPhaseCount; ++series) {
+    scratch.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+      Sample const &sample = ring[i];
+      scratch.push_back(series < kPhaseCount ? sample.phase_ms[series]
+                                             : sample.total_ms);
+    }
+    PhaseSummary &summary = summaries[series];
+    summary.max = *std::max_element(scratch.begin(), scratch.end());
+    summary.p99 = Percentile(scratch, 0.99f);
+    summary.p95 = Percentile(scratch, 0.95f);
+    summary.p50 = Percentile(scratch, 0.50f);
+  }
+}
+
+bool FrameStats::WriteCsv(std::string const &path) const {
+  std::ofstream out(path);
+  if (!out) {
+    return false;
+  }
+  out << "frame";
+  for (std::size_t phase = 0; phase < kPhaseCount; ++phase) {
+    out << "," << PhaseName(static_cast<FramePhase>(phase)) << "_ms";
+  }
+  out << ",total_ms\n";
+
+  // Oldest buffered frame first.
+  std::size_t const first = count < kCapacity ? 0 : next;
+  for (std::size_t i = 0; i < count; ++i) {
+    Sample const &sample = ring[(first + i) % kCapacity];
+    out << frame_number - count + i;
+    for (float ms : sample.phase_ms) {
+      out << "," << ms;
+    }
+    out << "," << sample.total_ms << "\n";
+  }
+  return static_cast<bool>(out);
+}
+
+void LatencyHistogram::Record(float ms) {
+  ms = std::max(ms, 0.0f);
+  std::size_t const bucket =
+      std::min(kBucketCount - 1, static_cast<std::size_t>(ms / kBucketMs));
+  ++buckets[bucket];
+  ++count;
+  max_ms = std::max(max_ms, ms);
+}
+
+void LatencyHistogram::Clear() {
+  buckets.fill(0);
+  count = 0;
+  max_ms = 0.0f;
+}
+
+float LatencyHistogram::Percentile(float fraction) const {
+  if (count == 0) {
+    return 0.0f;
+  }
+  std::uint64_t const target = std::min(
+      count, static_cast<std::uint64_t>(fraction * static_cast<float>(count)) + 1);
+  std::uint64_t seen = 0;
+  for (std::size_t i = 0; i < kBucketCount; ++i) {
+    seen += buckets[i];
+    if (seen >= target) {
+      return std::min(max_ms, static_cast<float>(i + 1) * kBucketMs);
+    }
+  }
+  return max_ms;
+}
+
+std::uint64_t LatencyHistogram::CountAbove(float ms) const {
+  std::size_t const first =
+      static_cast<std::size_t>(std::max(ms, 0.0f) / kBucketMs) + 1;
+  std::uint64_t above = 0;
+  for (std::size_t i = first; i < kBucketCount; ++i) {
+    above += buckets[i];
+  }
+  return above;
+}
+
+char const *FrameStats::PhaseName(FramePhase phase) {
+  switch (phase) {
+    case FramePhase::kEvents:
+      return "events";
+    case FramePhase::kInput:
+      return "input";
+    case FramePhase::kUpdate:
+      return "update";
+    case FramePhase::kRender:
+      return "render";
+    case FramePhase::kPresent:
+      return "present";
+    case FramePhase::kSleep:
+      return "sleep";
+  }
+  return "unknown";
+}
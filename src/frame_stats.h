@@ -0,0 +1,119 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Per-Phase Frame Timing Statistics
+ * ============================================================================
+ * 
+ * File: frame_stats.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Records how long each phase of the main loop takes (event polling,
+ * input, simulation update, rendering, present, sleep) for every frame in
+ * a fixed-size ring buffer. Percentile summaries (p50/p95/p99/max) over
+ * the buffered window feed the in-game performance overlay, and the raw
+ * per-frame samples can be written to CSV for offline analysis.
+ * 
+ * Durations are supplied in milliseconds by the caller, which measures
+ * them with the high-resolution performance counter.
+ *
+ * LatencyHistogram counts one-off delays (such as key press to simulation
+ * tick) into fixed buckets, so recording costs no allocation and a long
+ * session keeps every sample.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class FramePhase { kEvents, kInput, kUpdate, kRender, kPresent, kSleep };
+
+struct PhaseSummary {
+  float p50{0.0f};
+  float p95{0.0f};
+  float p99{0.0f};
+  float max{0.0f};
+};
+
+class FrameStats {
+ public:
+  static constexpr std::size_t kPhaseCount{6};
+  static constexpr std::size_t kCapacity{4096};
+
+  FrameStats();
+
+  void BeginFrame();
+  void AddPhase(FramePhase phase, float ms) {
+    current.phase_ms[static_cast<std::size_t>(phase)] += ms;
+  }
+  // Closes the frame; `total_ms` is the full loop iteration time.
+  void EndFrame(float total_ms);
+
+  // Summaries over the buffered window. Recomputed every few frames so the
+  // overlay does not pay for a percentile pass on every frame.
+  PhaseSummary const &Phase(FramePhase phase) const {
+    return summaries[static_cast<std::size_t>(phase)];
+  }
+  PhaseSummary const &Total() const { return summaries[kPhaseCount]; }
+
+  std::size_t FrameCount() const { return count; }
+  // Total frame time of the i-th most recent frame (0 = newest).
+  float RecentTotal(std::size_t i) const;
+
+  bool WriteCsv(std::string const &path) const;
+
+  static char const *PhaseName(FramePhase phase);
+
+ private:
+  struct Sample {
+    std::array<float, kPhaseCount> phase_ms;
+    float total_ms;
+  };
+
+  void RefreshSummaries();
+
+  std::vector<Sample> ring;
+  std::size_t next{0};
+  std::size_t count{0};
+  std::uint64_t frame_number{0};
+  Sample current{};
+
+  std::size_t frames_since_summary{0};
+  std::array<PhaseSummary, kPhaseCount + 1> summaries{};
+  std::vector<float> scratch;
+};
+
+// Fixed-width latency buckets; samples beyond the last bucket are counted
+// in it. Not thread-safe: record from one thread, read once it has stopped.
+class LatencyHistogram {
+ public:
+  static constexpr float kBucketMs{0.25f};
+  static constexpr std::size_t kBucketCount{400};  // Up to 100 ms
+
+  void Record(float ms);
+  void Clear();
+
+  std::uint64_t Count() const { return count; }
+  float Max() const { return max_ms; }
+  // Upper edge of the bucket holding the given fraction of samples.
+  float Percentile(float fraction) const;
+  // Samples in buckets that lie wholly above `ms`.
+  std::uint64_t CountAbove(float ms) const;
+  std::uint64_t Bucket(std::size_t i) const { return buckets[i]; }
+
+ private:
+  std::array<std::uint64_t, kBucketCount> buckets{};
+  std::uint64_t count{0};
+  float max_ms{0.0f};
+};
+
+#endif
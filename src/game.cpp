@@ -9,67 +9,147 @@
  * Version: 1.0.0
  * 
  * Description:
- * Implementation of the core game logic with professional architecture.
- * Features state-of-the-art game mechanics, audio feedback, and smooth
- * state transitions for an engaging user experience.
+ * Implementation of the SDL game loop with professional architecture.
+ * Runs the headless simulation on a dedicated thread at a fixed tick rate,
+ * renders its published snapshots on the main thread, and turns its
+ * events into audio feedback and particle effects.
  * 
  * Copyright (c) 2025 Your Name. All rights reserved.
  * ============================================================================
  */
 
 #include "game.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include "SDL.h"
 
-Game::Game(std::size_t grid_width, std::size_t grid_height)
-    : snake(grid_width, grid_height),
-      game_state(GameState::StartScreen),
-      grid_width(grid_width),
-      grid_height(grid_height),
-      engine(dev()),
-      random_w(0, static_cast<int>(grid_width - 1)),
-      random_h(0, static_cast<int>(grid_height - 1)) {
-  audio_manager.Initialize();
-  PlaceFood();
+Game::Game(std::size_t grid_width, std::size_t grid_height,
+           std::uint64_t seed, AudioSettings const &audio_settings)
+    : seed(seed),
+      simulation(static_cast<int>(grid_width), static_cast<int>(grid_height),
+                 seed) {
+  audio_manager.Initialize(audio_settings);
+  PublishSnapshot();
+}
+
+bool Game::StartRecording(std::string const &path,
+                          std::size_t ticks_per_second) {
+  ReplayHeader header;
+  header.grid_width = static_cast<std::uint32_t>(simulation.GridWidth());
+  header.grid_height = static_cast<std::uint32_t>(simulation.GridHeight());
+  header.ticks_per_second = static_cast<std::uint32_t>(ticks_per_second);
+  header.seed = seed;
+  return replay_writer.Open(path, header);
+}
+
+bool Game::StartPlayback(ReplayReader reader) {
+  ReplayHeader const &header = reader.Header();
+  if (header.seed != seed ||
+      header.grid_width != static_cast<std::uint32_t>(simulation.GridWidth()) ||
+      header.grid_height != static_cast<std::uint32_t>(simulation.GridHeight())) {
+    return false;
+  }
+  replay_player = std::make_unique<ReplayPlayer>(std::move(reader));
+  return true;
 }
 
 void Game::Run(Controller &controller, Renderer &renderer,
-               std::size_t target_frame_duration) {
-  Uint32 title_timestamp = SDL_GetTicks();
-  Uint32 frame_start;
-  Uint32 frame_end;
-  Uint32 frame_duration;
+               std::size_t ticks_per_second,
+               std::size_t max_frames_per_second) {
+  // All loop timing uses the high-resolution counter. The simulation thread
+  // advances in fixed ticks; this thread renders once per loop iteration
+  // and interpolates between the last two published ticks, so neither
+  // game speed nor input sampling depends on the frame rate.
+  Uint64 const counter_frequency = SDL_GetPerformanceFrequency();
+  Uint64 const tick_counts = counter_frequency / ticks_per_second;
+  Uint64 const min_frame_counts =
+      max_frames_per_second > 0 ? counter_frequency / max_frames_per_second
+                                : 0;
+  float const tick_seconds = 1.0f / static_cast<float>(ticks_per_second);
+
+  // Cap how many particle steps one slow frame may catch up on.
+  constexpr std::uint64_t kMaxParticleStepsPerFrame{5};
+
+  // Converts a performance-counter interval to milliseconds.
+  auto to_ms = [counter_frequency](Uint64 counts) {
+    return static_cast<float>(static_cast<double>(counts) * 1000.0 /
+                              static_cast<double>(counter_frequency));
+  };
+
+  simulation_running.store(true, std::memory_order_release);
+  std::thread simulation_thread(&Game::SimulationLoop, this, ticks_per_second);
+
+  Uint64 previous_time = SDL_GetPerformanceCounter();
+  Uint64 title_timestamp = previous_time;
+  float longest_frame_ms = 0.0f;
   int frame_count = 0;
   bool running = true;
 
   while (running) {
-    frame_start = SDL_GetTicks();
+    Uint64 const frame_start = SDL_GetPerformanceCounter();
+    Uint64 const elapsed = frame_start - previous_time;
+    previous_time = frame_start;
+    frame_stats.BeginFrame();
+
+    // The newest published state; decisions below are based on it.
+    snapshots.Acquire();
+    RenderSnapshot const &snapshot = snapshots.ReadBuffer();
 
     // Input, Update, Render - the main game loop.
     // Handle input based on game state using events
+    // SDL stamps events in milliseconds; back-date the counter by each
+    // event's age so latency is measured from the key press itself.
+    Uint64 const poll_counter = SDL_GetPerformanceCounter();
+    Uint32 const poll_ticks = SDL_GetTicks();
+    auto event_counter = [&](Uint32 event_ticks) {
+      Uint64 const age_ms =
+          poll_ticks > event_ticks ? poll_ticks - event_ticks : 0;
+      return poll_counter -
+             std::min(poll_counter, age_ms * counter_frequency / 1000);
+    };
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
       if (event.type == SDL_QUIT) {
         running = false;
+      } else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3) {
+        // Toggle the performance overlay in any state
+        show_perf_overlay = !show_perf_overlay;
+      } else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F4) {
+        // Toggle the fireworks particle stress mode in any state
+        renderer.SetFireworksMode(!renderer.FireworksMode());
+      } else if (event.type == SDL_KEYDOWN && replay_player != nullptr) {
+        HandlePlaybackKey(event.key.keysym.sym, running);
+      } else if (event.type == SDL_RENDER_TARGETS_RESET) {
+        // Render target contents were lost (e.g. Direct3D device reset)
+        renderer.InvalidateRenderTargets();
       } else if (event.type == SDL_KEYDOWN) {
-        switch (game_state) {
+        switch (snapshot.state) {
           case GameState::StartScreen:
             // Any key starts the game
-            game_state = GameState::Playing;
+            SendCommand(GameCommand::Type::kStart);
             break;
           case GameState::Playing:
+            if (controller.HandleKey(event.key,
+                                     event_counter(event.key.timestamp))) {
+              break;
+            }
             if (event.key.keysym.sym == SDLK_SPACE) {
-              game_state = GameState::Paused;
+              // Turns pressed before the pause still count
+              ForwardTurns(controller);
+              SendCommand(GameCommand::Type::kTogglePause);
             }
             break;
           case GameState::Paused:
             if (event.key.keysym.sym == SDLK_SPACE) {
-              game_state = GameState::Playing;
+              SendCommand(GameCommand::Type::kTogglePause);
             } else if (event.key.keysym.sym == SDLK_ESCAPE) {
               running = false;
             }
             break;
           case GameState::GameOver:
+          case GameState::Won:
             if (event.key.keysym.sym == SDLK_r) {
               RestartGame();
             } else if (event.key.keysym.sym == SDLK_ESCAPE) {
@@ -79,96 +159,351 @@ void Game::Run(Controller &controller, Renderer &renderer,
         }
       }
     }
-    
-    // Handle game-specific input only when playing
-    if (game_state == GameState::Playing) {
-      controller.HandleInput(running, snake);
-      Update(renderer);
+
+    Uint64 phase_start = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kEvents, to_ms(phase_start - frame_start));
+
+    // Forward this frame's turns; the simulation queues them per cell
+    ForwardTurns(controller);
+    Uint64 const input_end = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kInput, to_ms(input_end - phase_start));
+
+    // Main-thread share of the update: react to new events and step the
+    // particles once per simulation tick that has elapsed.
+    ConsumeEvents(snapshot, renderer);
+    std::uint64_t const particle_steps =
+        std::min(snapshot.tick - particle_tick, kMaxParticleStepsPerFrame);
+    for (std::uint64_t i = 0; i < particle_steps; ++i) {
+      renderer.UpdateParticles(tick_seconds);
+    }
+    particle_tick = snapshot.tick;
+    Uint64 const update_end = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kUpdate, to_ms(update_end - input_end));
+
+    // Fraction of the next tick that has elapsed since this snapshot.
+    Uint64 const since_tick =
+        update_end > snapshot.tick_time ? update_end - snapshot.tick_time : 0;
+    float const alpha = std::min(
+        1.0f, static_cast<float>(since_tick) / static_cast<float>(tick_counts));
+    float const frame_seconds =
+        static_cast<float>(elapsed) / static_cast<float>(counter_frequency);
+    renderer.Render(snapshot, alpha, frame_seconds);
+    if (show_perf_overlay) {
+      renderer.RenderPerfOverlay(frame_stats);
     }
-    
-    renderer.Render(snake, food, score, game_state);
+    Uint64 const render_end = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kRender, to_ms(render_end - update_end));
 
-    frame_end = SDL_GetTicks();
+    renderer.Present();
+    Uint64 const frame_end = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kPresent, to_ms(frame_end - render_end));
 
-    // Keep track of how long each loop through the input/update/render cycle
-    // takes.
+    // Keep track of how many frames are rendered each second.
     frame_count++;
-    frame_duration = frame_end - frame_start;
 
     // After every second, update the window title.
-    if (frame_end - title_timestamp >= 1000) {
-      renderer.UpdateWindowTitle(score, frame_count);
+    if (frame_end - title_timestamp >= counter_frequency) {
+      renderer.UpdateWindowTitle(snapshot.score, frame_count);
       frame_count = 0;
       title_timestamp = frame_end;
     }
 
-    // If the time for this frame is too small (i.e. frame_duration is
-    // smaller than the target ms_per_frame), delay the loop to
-    // achieve the correct frame rate.
-    if (frame_duration < target_frame_duration) {
-      SDL_Delay(target_frame_duration - frame_duration);
+    // If the frame finished faster than the frame cap allows, sleep off the
+    // remainder. With vsync enabled the present call usually paces us first.
+    Uint64 const frame_duration = frame_end - frame_start;
+    if (frame_duration < min_frame_counts) {
+      SDL_Delay(static_cast<Uint32>((min_frame_counts - frame_duration) *
+                                    1000 / counter_frequency));
     }
+    Uint64 const sleep_end = SDL_GetPerformanceCounter();
+    frame_stats.AddPhase(FramePhase::kSleep, to_ms(sleep_end - frame_end));
+    frame_stats.EndFrame(to_ms(sleep_end - frame_start));
+    longest_frame_ms = std::max(longest_frame_ms, to_ms(sleep_end - frame_start));
   }
+
+  simulation_running.store(false, std::memory_order_release);
+  simulation_thread.join();
+
+  ReportFrameStats(to_ms(tick_counts), longest_frame_ms);
+  FinishReplay();
 }
 
-void Game::PlaceFood() {
-  int x, y;
-  while (true) {
-    x = random_w(engine);
-    y = random_h(engine);
-    // Check that the location is not occupied by a snake item before placing
-    // food.
-    if (!snake.SnakeCell(x, y)) {
-      food.x = x;
-      food.y = y;
-      return;
+void Game::SimulationLoop(std::size_t ticks_per_second) {
+  using Clock = std::chrono::steady_clock;
+  auto const tick_duration = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::nanoseconds(1000000000LL / ticks_per_second));
+
+  // After a stall, run at most this many catch-up ticks back to back.
+  constexpr int kMaxCatchUpTicks{5};
+
+  Uint64 const counter_frequency = SDL_GetPerformanceFrequency();
+  auto to_ms = [counter_frequency](Uint64 counts) {
+    return static_cast<float>(static_cast<double>(counts) * 1000.0 /
+                              static_cast<double>(counter_frequency));
+  };
+
+  Clock::time_point next_tick = Clock::now();
+  while (simulation_running.load(std::memory_order_acquire)) {
+    Clock::time_point const now = Clock::now();
+    if (now < next_tick) {
+      std::this_thread::sleep_until(next_tick);
+      continue;
+    }
+    if (now - next_tick > tick_duration * kMaxCatchUpTicks) {
+      next_tick = now;
+    }
+
+    // Commands queued by the main thread take effect at the tick boundary.
+    Uint64 const tick_counter = SDL_GetPerformanceCounter();
+    if (replay_writer.KeyframeDue(tick_count)) {
+      replay_writer.RecordKeyframe(tick_count, simulation);
+    }
+    GameCommand command;
+    while (commands.Pop(command)) {
+      if (replay_player != nullptr) {
+        continue;  // Playback supplies its own commands
+      }
+      if (command.type == GameCommand::Type::kTurn && command.timestamp != 0) {
+        input_to_tick.Record(to_ms(tick_counter - command.timestamp));
+      }
+      replay_writer.RecordCommand(tick_count, command);
+      simulation.Apply(command);
+    }
+
+    TickEvents events;
+    if (replay_player == nullptr) {
+      events = simulation.Tick();
+      replay_writer.RecordChecksum(tick_count, simulation.Checksum());
+    } else {
+      std::int64_t const seek = replay_seek.exchange(-1);
+      if (seek >= 0) {
+        replay_status = replay_player->SeekTo(
+            simulation, static_cast<std::uint64_t>(seek));
+      }
+      // Holds the last verified state while paused or once playback stops
+      if (!replay_paused.load(std::memory_order_relaxed) &&
+          replay_status == ReplayPlayer::Status::kTicked) {
+        replay_status = replay_player->Step(simulation, events);
+      }
+      replay_position.store(replay_player->Tick(), std::memory_order_relaxed);
     }
+    if (events.turned && events.turn_stamp != 0) {
+      input_to_turn.Record(to_ms(tick_counter - events.turn_stamp));
+    }
+    RecordEvents(events);
+    ++tick_count;
+    next_tick += tick_duration;
+    PublishSnapshot();
   }
 }
 
-void Game::Update(Renderer &renderer) {
-  if (!snake.alive) {
-    HandleGameOver(renderer);
-    return;
+void Game::RecordEvents(TickEvents const &events) {
+  auto record = [this](SnapshotEvent::Type type, Point cell) {
+    ++event_count;
+    event_history[event_count % event_history.size()] = {type, cell};
+  };
+  if (events.ate_food) {
+    record(SnapshotEvent::Type::kAteFood, events.food_eaten_at);
+  }
+  if (events.died) {
+    Snake const &snake = simulation.GetSnake();
+    record(SnapshotEvent::Type::kDied, Point{static_cast<int>(snake.head_x),
+                                             static_cast<int>(snake.head_y)});
+  }
+  if (events.won) {
+    record(SnapshotEvent::Type::kWon, Point{0, 0});
+  }
+}
+
+void Game::PublishSnapshot() {
+  RenderSnapshot &out = snapshots.WriteBuffer();
+  Snake const &snake = simulation.GetSnake();
+
+  // The slot still holds the body as it was when this slot was last
+  // written, a few ticks ago. If that is an older window of the same
+  // sequence, drop its vacated tail and append the new neck segments, so
+  // the cost follows the cells that changed rather than the length.
+  // Anything else (a replay seek, say) is copied whole.
+  std::uint64_t const end_seq = snake.body_pushes;
+  std::uint64_t const first_seq = end_seq - snake.body.size();
+  std::uint64_t out_first = out.body_end_seq - out.body.size();
+  bool in_place = out.body_end_seq <= end_seq &&
+                  (out.body.empty() || out_first <= first_seq);
+  if (in_place && !out.body.empty() && first_seq < out.body_end_seq) {
+    in_place = out.body.back() ==
+                   snake.body[out.body_end_seq - 1 - first_seq] &&
+               out.body[first_seq - out_first] == snake.body.front();
+  }
+  if (!in_place) {
+    out.body.clear();
+  }
+  while (!out.body.empty() && out_first < first_seq) {
+    out.body.pop_front();
+    ++out_first;
+  }
+  std::uint64_t const copy_from =
+      out.body.empty() ? first_seq : out.body_end_seq;
+  for (std::uint64_t seq = copy_from; seq < end_seq; ++seq) {
+    out.body.push_back(snake.body[seq - first_seq]);
+  }
+  out.body_end_seq = end_seq;
+  out.head_x = snake.head_x;
+  out.head_y = snake.head_y;
+  out.prev_head_x = snake.prev_head_x;
+  out.prev_head_y = snake.prev_head_y;
+  out.alive = snake.alive;
+  out.food = simulation.GetFood();
+  out.score = simulation.GetScore();
+  out.state = simulation.GetState();
+  out.tick = tick_count;
+  out.tick_time = SDL_GetPerformanceCounter();
+  out.event_count = event_count;
+  out.events = event_history;
+
+  snapshots.Publish();
+}
+
+void Game::ConsumeEvents(RenderSnapshot const &snapshot, Renderer &renderer) {
+  // Events older than the snapshot's history window are dropped.
+  std::uint64_t first = events_consumed + 1;
+  if (snapshot.event_count > RenderSnapshot::kEventHistory &&
+      first <= snapshot.event_count - RenderSnapshot::kEventHistory) {
+    first = snapshot.event_count - RenderSnapshot::kEventHistory + 1;
+  }
+  for (std::uint64_t seq = first; seq <= snapshot.event_count; ++seq) {
+    SnapshotEvent const &event =
+        snapshot.events[seq % RenderSnapshot::kEventHistory];
+    switch (event.type) {
+      case SnapshotEvent::Type::kAteFood:
+        // Play eating sound and emit particles
+        audio_manager.PlayEatSound();
+        renderer.EmitFoodParticles(static_cast<float>(event.cell.x),
+                                   static_cast<float>(event.cell.y));
+        break;
+      case SnapshotEvent::Type::kDied:
+        audio_manager.PlayGameOverSound();
+        renderer.EmitDeathParticles(static_cast<float>(event.cell.x),
+                                    static_cast<float>(event.cell.y));
+        break;
+      case SnapshotEvent::Type::kWon:
+        break;
+    }
   }
+  events_consumed = std::max(events_consumed, snapshot.event_count);
+}
+
+void Game::SendCommand(GameCommand::Type type, Snake::Direction direction,
+                       std::uint64_t timestamp) {
+  GameCommand command;
+  command.type = type;
+  command.direction = direction;
+  command.timestamp = timestamp;
+  commands.Push(command);
+}
 
-  snake.Update();
+void Game::ForwardTurns(Controller &controller) {
+  Snake::Direction direction;
+  Uint64 stamp;
+  while (controller.PopTurn(direction, stamp)) {
+    SendCommand(GameCommand::Type::kTurn, direction, stamp);
+  }
+}
 
-  int new_x = static_cast<int>(snake.head_x);
-  int new_y = static_cast<int>(snake.head_y);
+void Game::ReportFrameStats(float tick_ms, float longest_frame_ms) const {
+  constexpr char kCsvPath[] = "frame_stats.csv";
+  if (frame_stats.WriteCsv(kCsvPath)) {
+    std::cout << "Frame timings written to " << kCsvPath << "\n";
+  } else {
+    std::cerr << "Could not write " << kCsvPath << "\n";
+  }
 
-  // Check if there's food over here
-  if (food.x == new_x && food.y == new_y) {
-    score++;
-    // Play eating sound and emit particles
-    audio_manager.PlayEatSound();
-    renderer.EmitFoodParticles(static_cast<float>(food.x), static_cast<float>(food.y));
-    PlaceFood();
-    // Grow snake and increase speed.
-    snake.GrowBody();
-    snake.speed += 0.02;
+  std::cout << "Phase      p50 ms   p95 ms   p99 ms   max ms\n";
+  auto print_row = [](char const *name, PhaseSummary const &summary) {
+    std::printf("%-9s %7.3f  %7.3f  %7.3f  %7.3f\n", name, summary.p50,
+                summary.p95, summary.p99, summary.max);
+  };
+  for (std::size_t i = 0; i < FrameStats::kPhaseCount; ++i) {
+    FramePhase const phase = static_cast<FramePhase>(i);
+    print_row(FrameStats::PhaseName(phase), frame_stats.Phase(phase));
   }
+  print_row("frame", frame_stats.Total());
+
+  std::cout << "Input      p50 ms   p99 ms   max ms   count\n";
+  auto print_latency = [](char const *name, LatencyHistogram const &latency) {
+    std::printf("%-9s %7.3f  %7.3f  %7.3f  %6llu\n", name,
+                latency.Percentile(0.50f), latency.Percentile(0.99f),
+                latency.Max(), static_cast<unsigned long long>(latency.Count()));
+  };
+  print_latency("key-tick", input_to_tick);
+  print_latency("key-turn", input_to_turn);
+  // Presses that arrive while the main thread is blocked in Present() or
+  // the frame cap wait for the next poll, so only the frame-plus-tick
+  // bound is guaranteed; the first count shows how often that mattered.
+  std::printf("key-tick over 1 tick (%.3f ms): %llu, over 1 frame + 1 tick "
+              "(%.3f ms): %llu\n",
+              tick_ms,
+              static_cast<unsigned long long>(input_to_tick.CountAbove(tick_ms)),
+              tick_ms + longest_frame_ms,
+              static_cast<unsigned long long>(
+                  input_to_tick.CountAbove(tick_ms + longest_frame_ms)));
 }
 
-void Game::HandleGameOver(Renderer &renderer) {
-  if (game_state == GameState::Playing) {
-    // First time entering game over state
-    game_state = GameState::GameOver;
-    audio_manager.PlayGameOverSound();
+void Game::HandlePlaybackKey(SDL_Keycode key, bool &running) {
+  std::int64_t const second = replay_player->Header().ticks_per_second;
+  std::int64_t const position =
+      static_cast<std::int64_t>(replay_position.load(std::memory_order_relaxed));
+  std::int64_t target;
+  switch (key) {
+    case SDLK_ESCAPE:
+      running = false;
+      return;
+    case SDLK_SPACE:
+      replay_paused.store(!replay_paused.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+      return;
+    case SDLK_LEFT:
+      target = position - 5 * second;
+      break;
+    case SDLK_RIGHT:
+      target = position + 5 * second;
+      break;
+    case SDLK_PAGEDOWN:
+      target = position - 60 * second;
+      break;
+    case SDLK_PAGEUP:
+      target = position + 60 * second;
+      break;
+    case SDLK_HOME:
+      target = 0;
+      break;
+    case SDLK_END:
+      target = static_cast<std::int64_t>(replay_player->TickCount());
+      break;
+    default:
+      return;
   }
+  // The simulation thread clamps to the replay's length
+  replay_seek.store(std::max<std::int64_t>(0, target));
 }
 
-void Game::RestartGame() {
-  // Reset game state
-  game_state = GameState::Playing;
-  score = 0;
-  
-  // Reset snake
-  snake = Snake(grid_width, grid_height);
-  
-  // Place new food
-  PlaceFood();
+void Game::FinishReplay() {
+  if (replay_writer.IsOpen() && !replay_writer.Close()) {
+    std::cerr << "Could not finish writing the replay\n";
+  }
+  if (replay_player == nullptr) {
+    return;
+  }
+  std::cout << "Replay " << ReplayPlayer::StatusName(replay_status)
+            << " at tick " << replay_player->Tick();
+  if (replay_status == ReplayPlayer::Status::kDesync) {
+    std::printf(" (checksum %08x, recorded %08x)",
+                replay_player->ActualChecksum(),
+                replay_player->ExpectedChecksum());
+  }
+  std::cout << "\n";
 }
 
-int Game::GetScore() const { return score; }
-int Game::GetSize() const { return snake.size; }
\ No newline at end of file
+void Game::RestartGame() { SendCommand(GameCommand::Type::kRestart); }
+
+int Game::GetScore() const { return simulation.GetScore(); }
+int Game::GetSize() const { return simulation.GetSize(); }
@@ -9,12 +9,13 @@
  * Version: 1.0.0
  * 
  * Description:
- * Core game logic implementation featuring advanced state management,
- * audio integration, and professional game flow control. Handles all
- * game mechanics including scoring, collision detection, and state transitions.
+ * Core game loop featuring advanced state management, audio integration,
+ * and professional game flow control. The rules themselves (scoring,
+ * collision detection, state transitions) live in the SDL-free Simulation;
+ * this class connects them to the window, keyboard and speakers.
  * 
  * Key Features:
- * - Multi-state game management (Start, Playing, Paused, GameOver)
+ * - Multi-state game management (Start, Playing, Paused, GameOver, Won)
  * - Integrated audio system with programmatic sound generation
  * - Advanced collision detection and game physics
  * - Professional error handling and resource management
@@ -26,41 +27,116 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <random>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
 #include "SDL.h"
 #include "controller.h"
+#include "frame_stats.h"
+#include "game_command.h"
+#include "render_snapshot.h"
 #include "renderer.h"
-#include "snake.h"
+#include "replay.h"
+#include "simulation.h"
+#include "spsc_queue.h"
+#include "triple_buffer.h"
 #include "audio.h"
 
+// SDL front end: wraps the headless Simulation with window, input, audio
+// and the real-time loop.
+//
+// While Run() is active the simulation advances on its own thread at a
+// fixed tick rate. The main thread polls events and sends commands through
+// a lock-free queue, then renders whatever snapshot the simulation thread
+// published last, so vsync waits never delay ticks or input sampling.
+//
+// Arrow keys are forwarded as timestamped turn commands once per frame. A
+// command takes effect at the next tick, so key-to-tick latency is at most
+// one frame plus one tick rather than one tick: SDL only delivers events
+// to the main thread when it pumps them, and that thread can be blocked
+// in Present() or the frame cap for up to a frame. The simulation thread
+// records the latency, along with key-to-turn latency (which also includes
+// the wait for the head to reach a new cell when turns are queued back to
+// back), and Run() prints both with how many key presses missed the
+// one-tick and the one-frame-plus-one-tick bounds.
+//
+// A game can be recorded to a replay file as it is played, or driven
+// from one in real time instead of from the keyboard.
 class Game {
  public:
-  Game(std::size_t grid_width, std::size_t grid_height);
+  Game(std::size_t grid_width, std::size_t grid_height, std::uint64_t seed,
+       AudioSettings const &audio_settings = AudioSettings{});
+  // Call these before Run(). Recording writes every command, tick checksum
+  // and keyframe to `path`. Playback replaces keyboard input with
+  // `reader`, whose seed and grid must match this game's. During playback
+  // Space pauses, Left/Right scrub 5 seconds, Page Up/Down a minute,
+  // Home/End jump to either end and Escape stops.
+  bool StartRecording(std::string const &path, std::size_t ticks_per_second);
+  bool StartPlayback(ReplayReader reader);
   void Run(Controller &controller, Renderer &renderer,
-           std::size_t target_frame_duration);
+           std::size_t ticks_per_second, std::size_t max_frames_per_second);
+  // Only meaningful once Run() has returned.
   int GetScore() const;
   int GetSize() const;
   void RestartGame();
 
  private:
-  Snake snake;
-  SDL_Point food;
-  GameState game_state;
-  AudioManager audio_manager;
-  
-  std::size_t grid_width;
-  std::size_t grid_height;
+  // Simulation thread body.
+  void SimulationLoop(std::size_t ticks_per_second);
+  void RecordEvents(TickEvents const &events);
+  void PublishSnapshot();
+
+  // Main thread: plays sounds and spawns particles for new snapshot events.
+  void ConsumeEvents(RenderSnapshot const &snapshot, Renderer &renderer);
+  void SendCommand(GameCommand::Type type,
+                   Snake::Direction direction = Snake::Direction::kUp,
+                   std::uint64_t timestamp = 0);
+  // Sends every turn queued in `controller`, oldest first.
+  void ForwardTurns(Controller &controller);
+
+  std::uint64_t const seed;
 
-  std::random_device dev;
-  std::mt19937 engine;
-  std::uniform_int_distribution<int> random_w;
-  std::uniform_int_distribution<int> random_h;
+  // Owned by the simulation thread while Run() is active.
+  Simulation simulation;
+  std::uint64_t tick_count{0};
+  std::uint64_t event_count{0};
+  std::array<SnapshotEvent, RenderSnapshot::kEventHistory> event_history{};
+  // Key press to the tick that consumed the turn command, and to the tick
+  // the turn took effect. Read them only after the thread has stopped.
+  LatencyHistogram input_to_tick;
+  LatencyHistogram input_to_turn;
+  ReplayWriter replay_writer;
+  std::unique_ptr<ReplayPlayer> replay_player;
+  ReplayPlayer::Status replay_status{ReplayPlayer::Status::kTicked};
 
-  int score{0};
+  // Cross-thread channels.
+  SpscQueue<GameCommand, 256> commands;
+  TripleBuffer<RenderSnapshot> snapshots;
+  std::atomic<bool> simulation_running{false};
+  // Playback control: a requested tick (-1 for none), the pause flag and
+  // the tick the simulation thread has reached.
+  std::atomic<std::int64_t> replay_seek{-1};
+  std::atomic<bool> replay_paused{false};
+  std::atomic<std::uint64_t> replay_position{0};
+
+  // Owned by the main thread.
+  AudioManager audio_manager;
+  FrameStats frame_stats;
+  bool show_perf_overlay{false};
+  std::uint64_t events_consumed{0};
+  std::uint64_t particle_tick{0};
 
-  void PlaceFood();
-  void Update(Renderer &renderer);
-  void HandleGameOver(Renderer &renderer);
+  // Dumps the buffered frame timings to CSV and prints the percentiles,
+  // then the input latency summary against a tick of `tick_ms` and the
+  // longest frame of the run, `longest_frame_ms`.
+  void ReportFrameStats(float tick_ms, float longest_frame_ms) const;
+  // Main thread: playback controls.
+  void HandlePlaybackKey(SDL_Keycode key, bool &running);
+  // Closes the recording and prints how playback ended.
+  void FinishReplay();
 };
 
 #endif
\ No newline at end of file
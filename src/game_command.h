@@ -0,0 +1,36 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Player Commands
+ * ============================================================================
+ * 
+ * File: game_command.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Everything a player can ask of the simulation, as a small value type.
+ * Front ends translate keys into commands and hand them to whoever owns
+ * the Simulation, which applies them at the start of its next tick.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef GAME_COMMAND_H
+#define GAME_COMMAND_H
+
+#include <cstdint>
+#include "snake.h"
+
+struct GameCommand {
+  enum class Type { kStart, kTogglePause, kRestart, kTurn };
+
+  Type type{Type::kStart};
+  Snake::Direction direction{Snake::Direction::kUp};  // For kTurn.
+  // Performance counter value when the key was pressed (kTurn), so the
+  // simulation thread can measure input latency.
+  std::uint64_t timestamp{0};
+};
+
+#endif
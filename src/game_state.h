@@ -0,0 +1,26 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Game State Machine States
+ * ============================================================================
+ * 
+ * File: game_state.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+enum class GameState {
+  StartScreen,
+  Playing,
+  Paused,
+  GameOver,
+  Won
+};
+
+#endif
@@ -24,23 +24,101 @@
  * ============================================================================
  */
 
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include "board_limits.h"
 #include "controller.h"
 #include "game.h"
 #include "renderer.h"
+#include "replay.h"
 
-int main() {
-  constexpr std::size_t kFramesPerSecond{60};
-  constexpr std::size_t kMsPerFrame{1000 / kFramesPerSecond};
+int main(int argc, char *argv[]) {
+  // Simulation rate is fixed; rendering runs up to the frame cap (or vsync)
+  // and interpolates between ticks. 0 disables the frame cap.
+  constexpr std::size_t kTicksPerSecond{60};
+  constexpr std::size_t kMaxFramesPerSecond{240};
   constexpr std::size_t kScreenWidth{640};
   constexpr std::size_t kScreenHeight{640};
   constexpr std::size_t kGridWidth{32};
   constexpr std::size_t kGridHeight{32};
 
-  Renderer renderer(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight);
+  // Audio device parameters; see AudioSettings. snake_bench
+  // --audio-latency measures the trade-off for each buffer size.
+  AudioSettings audio_settings;
+  std::string record_path;
+  std::string replay_path;
+  long requested_width = kGridWidth;
+  long requested_height = kGridHeight;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--audio-rate") == 0 && i + 1 < argc) {
+      audio_settings.sample_rate = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--audio-buffer") == 0 && i + 1 < argc) {
+      audio_settings.buffer_frames = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      record_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replay_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--grid") == 0 && i + 2 < argc) {
+      requested_width = std::atol(argv[++i]);
+      requested_height = std::atol(argv[++i]);
+    } else {
+      std::cerr << "Usage: SnakeGame [--audio-rate HZ] [--audio-buffer FRAMES]\n"
+                   "                 [--grid W H] [--record FILE | --replay FILE]\n";
+      return 1;
+    }
+  }
+  if (audio_settings.sample_rate < 8000 || audio_settings.sample_rate > 192000 ||
+      audio_settings.buffer_frames < 64 || audio_settings.buffer_frames > 16384) {
+    std::cerr << "Audio rate must be 8000-192000 Hz and the buffer 64-16384 frames.\n";
+    return 1;
+  }
+  if (!record_path.empty() && !replay_path.empty()) {
+    std::cerr << "--record and --replay cannot be combined.\n";
+    return 1;
+  }
+  // Boards that do not fit the window at 20 pixels per cell scroll with
+  // the head and show a minimap.
+  if (!ValidGridSize(requested_width, requested_height)) {
+    std::cerr << "The grid must be " << kMinGridSide << "-" << kMaxGridSide
+              << " cells on each side.\n";
+    return 1;
+  }
+
+  // A replay brings its own seed, grid and tick rate; --grid is ignored.
+  std::uint64_t seed = std::random_device{}();
+  std::size_t grid_width = static_cast<std::size_t>(requested_width);
+  std::size_t grid_height = static_cast<std::size_t>(requested_height);
+  std::size_t ticks_per_second = kTicksPerSecond;
+  ReplayReader replay;
+  if (!replay_path.empty()) {
+    if (!replay.Open(replay_path)) {
+      std::cerr << "Could not read replay " << replay_path << "\n";
+      return 1;
+    }
+    seed = replay.Header().seed;
+    grid_width = replay.Header().grid_width;
+    grid_height = replay.Header().grid_height;
+    ticks_per_second = replay.Header().ticks_per_second;
+  }
+
+  Renderer renderer(kScreenWidth, kScreenHeight, grid_width, grid_height);
   Controller controller;
-  Game game(kGridWidth, kGridHeight);
-  game.Run(controller, renderer, kMsPerFrame);
+  Game game(grid_width, grid_height, seed, audio_settings);
+  if (!record_path.empty() &&
+      !game.StartRecording(record_path, ticks_per_second)) {
+    std::cerr << "Could not create replay " << record_path << "\n";
+    return 1;
+  }
+  if (!replay_path.empty() && !game.StartPlayback(std::move(replay))) {
+    std::cerr << "Replay " << replay_path << " does not match this game\n";
+    return 1;
+  }
+  game.Run(controller, renderer, ticks_per_second, kMaxFramesPerSecond);
   std::cout << "Game has terminated successfully!\n";
   std::cout << "Score: " << game.GetScore() << "\n";
   std::cout << "Size: " << game.GetSize() << "\n";
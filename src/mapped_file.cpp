@@ -0,0 +1,112 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Read-Only Memory-Mapped File Implementation
+ * ============================================================================
+ *
+ * File: mapped_file.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "mapped_file.h"
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data(std::exchange(other.data, nullptr)),
+      size(std::exchange(other.size, 0)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Close();
+    data = std::exchange(other.data, nullptr);
+    size = std::exchange(other.size, 0);
+  }
+  return *this;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::Open(std::string const &path) {
+  Close();
+  HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE const mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);  // The mapping keeps the file open
+  if (mapping == nullptr) {
+    return false;
+  }
+  void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);  // The view keeps the mapping alive
+  if (view == nullptr) {
+    return false;
+  }
+  data = static_cast<unsigned char const *>(view);
+  size = static_cast<std::size_t>(file_size.QuadPart);
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data != nullptr) {
+    UnmapViewOfFile(data);
+  }
+  data = nullptr;
+  size = 0;
+}
+
+#else
+
+bool MappedFile::Open(std::string const &path) {
+  Close();
+  int const fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  void *view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+  close(fd);  // The mapping keeps the file open
+  if (view == MAP_FAILED) {
+    return false;
+  }
+  data = static_cast<unsigned char const *>(view);
+  size = static_cast<std::size_t>(info.st_size);
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data != nullptr) {
+    munmap(const_cast<unsigned char *>(data), size);
+  }
+  data = nullptr;
+  size = 0;
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Read-Only Memory-Mapped File
+ * ============================================================================
+ *
+ * File: mapped_file.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * Maps a whole file read-only into memory (mmap on POSIX, a file mapping
+ * object on Windows). Pages are loaded lazily by the OS and shared with
+ * the page cache, so opening a large cache file costs almost nothing
+ * until its bytes are touched.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile() { Close(); }
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  MappedFile(MappedFile const &) = delete;
+  MappedFile &operator=(MappedFile const &) = delete;
+
+  // Maps `path`, replacing any current mapping. Returns false if the file
+  // is missing, empty or cannot be mapped.
+  bool Open(std::string const &path);
+  void Close();
+
+  bool IsOpen() const { return data != nullptr; }
+  unsigned char const *Data() const { return data; }
+  std::size_t Size() const { return size; }
+
+ private:
+  unsigned char const *data{nullptr};
+  std::size_t size{0};
+};
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Grid Occupancy Bitmap Implementation
+ * ============================================================================
+ * 
+ * File: occupancy_grid.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "occupancy_grid.h"
+#include <algorithm>
+
+OccupancyGrid::OccupancyGrid(int grid_width, int grid_height)
+    : grid_width(grid_width),
+      grid_height(grid_height),
+      words((static_cast<std::size_t>(grid_width) * grid_height + 63) / 64,
+            0) {
+  free_cells.reserve(static_cast<std::size_t>(grid_width) * grid_height);
+  free_slot.resize(static_cast<std::size_t>(grid_width) * grid_height);
+  Reset();
+}
+
+void OccupancyGrid::Reset() {
+  std::fill(words.begin(), words.end(), 0);
+  free_cells.clear();
+  for (std::size_t cell = 0; cell < free_slot.size(); ++cell) {
+    free_slot[cell] = static_cast<std::uint32_t>(cell);
+    free_cells.push_back(static_cast<std::uint32_t>(cell));
+  }
+}
@@ -0,0 +1,89 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Grid Occupancy Bitmap
+ * ============================================================================
+ * 
+ * File: occupancy_grid.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Packed one-bit-per-cell occupancy map of the playing field. The snake
+ * keeps it in sync as the head advances and the tail retracts, so asking
+ * whether a cell is taken is a single bit test instead of a body scan.
+ * 
+ * Alongside the bitmap it keeps a dense list of the free cells plus each
+ * cell's slot in that list. Occupying a cell swap-removes it from the list
+ * and releasing it appends it again, so a uniformly random free cell is
+ * always one index away no matter how full the board is.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <cstdint>
+#include <vector>
+
+class OccupancyGrid {
+ public:
+  OccupancyGrid(int grid_width, int grid_height);
+
+  bool Test(int x, int y) const {
+    std::size_t const bit = Index(x, y);
+    return (words[bit >> 6] >> (bit & 63)) & 1u;
+  }
+  void Set(int x, int y) {
+    std::size_t const bit = Index(x, y);
+    std::uint64_t const mask = std::uint64_t{1} << (bit & 63);
+    if (words[bit >> 6] & mask) {
+      return;
+    }
+    words[bit >> 6] |= mask;
+
+    // Swap-remove the cell from the free list.
+    std::uint32_t const slot = free_slot[bit];
+    std::uint32_t const moved = free_cells.back();
+    free_cells[slot] = moved;
+    free_slot[moved] = slot;
+    free_cells.pop_back();
+  }
+  void Clear(int x, int y) {
+    std::size_t const bit = Index(x, y);
+    std::uint64_t const mask = std::uint64_t{1} << (bit & 63);
+    if (!(words[bit >> 6] & mask)) {
+      return;
+    }
+    words[bit >> 6] &= ~mask;
+
+    free_slot[bit] = static_cast<std::uint32_t>(free_cells.size());
+    free_cells.push_back(static_cast<std::uint32_t>(bit));
+  }
+  void Reset();
+
+  // Free cells are addressed by a dense index in [0, FreeCount()).
+  std::size_t FreeCount() const { return free_cells.size(); }
+  void FreeCell(std::size_t n, int &x, int &y) const {
+    x = static_cast<int>(free_cells[n] % grid_width);
+    y = static_cast<int>(free_cells[n] / grid_width);
+  }
+
+  int Width() const { return grid_width; }
+  int Height() const { return grid_height; }
+
+ private:
+  std::size_t Index(int x, int y) const {
+    return static_cast<std::size_t>(y) * grid_width + x;
+  }
+
+  int grid_width;
+  int grid_height;
+  std::vector<std::uint64_t> words;
+  std::vector<std::uint32_t> free_cells;
+  std::vector<std::uint32_t> free_slot;
+};
+
+#endif
@@ -17,21 +17,93 @@
  */
 
 #include "particle.h"
+#include "work_stealing_pool.h"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
-ParticleSystem::ParticleSystem() 
-    : rng(std::random_device{}()),
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Downward acceleration in grid cells per second squared.
+constexpr float kGravity = 50.0f;
+
+// Particles per vector block; parallel ranges start on block boundaries.
+constexpr std::size_t kSimdBlock = 8;
+
+// Pool time is folded back to zero past this point so that float death
+// times keep sub-millisecond precision.
+constexpr float kClockRebase = 1024.0f;
+
+// Advances particles [begin, end) by `dt`: moves them by their current
+// velocity, then applies gravity. The vector paths do exactly the same
+// float operations as the scalar tail, so results do not depend on which
+// path ran.
+void Integrate(float* x, float* y, const float* velocity_x, float* velocity_y,
+               std::size_t begin, std::size_t end, float dt) {
+    std::size_t i = begin;
+#if defined(__AVX__)
+    const __m256 step = _mm256_set1_ps(dt);
+    const __m256 fall = _mm256_set1_ps(kGravity * dt);
+    for (; i + 8 <= end; i += 8) {
+        __m256 vy = _mm256_loadu_ps(velocity_y + i);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i),
+                                              _mm256_mul_ps(_mm256_loadu_ps(velocity_x + i), step)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(vy, step)));
+        _mm256_storeu_ps(velocity_y + i, _mm256_add_ps(vy, fall));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 step = _mm_set1_ps(dt);
+    const __m128 fall = _mm_set1_ps(kGravity * dt);
+    for (; i + 4 <= end; i += 4) {
+        __m128 vy = _mm_loadu_ps(velocity_y + i);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i),
+                                        _mm_mul_ps(_mm_loadu_ps(velocity_x + i), step)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(vy, step)));
+        _mm_storeu_ps(velocity_y + i, _mm_add_ps(vy, fall));
+    }
+#endif
+    // Scalar fallback and remainder
+    const float fall_scalar = kGravity * dt;
+    for (; i < end; ++i) {
+        x[i] += velocity_x[i] * dt;
+        y[i] += velocity_y[i] * dt;
+        velocity_y[i] += fall_scalar;
+    }
+}
+
+}  // namespace
+
+ParticleSystem::ParticleSystem(std::size_t pool_capacity, std::uint32_t seed)
+    : workers(nullptr),
+      capacity(pool_capacity),
+      count(0),
+      integrated_count(0),
+      clock(0.0f),
+      last_dt(0.0f),
+      next_death(std::numeric_limits<float>::infinity()),
+      x(pool_capacity), y(pool_capacity),
+      velocity_x(pool_capacity), velocity_y(pool_capacity),
+      death_time(pool_capacity),
+      inv_max_life(pool_capacity),
+      size(pool_capacity),
+      color_r(pool_capacity), color_g(pool_capacity), color_b(pool_capacity),
+      rng(seed),
       angle_dist(0.0f, 2.0f * M_PI),
       speed_dist(50.0f, 200.0f),
       life_dist(0.5f, 2.0f) {
 }
 
-void ParticleSystem::EmitFoodParticles(float x, float y, int count) {
-    for (int i = 0; i < count; ++i) {
+void ParticleSystem::EmitFoodParticles(float origin_x, float origin_y, int emit_count) {
+    for (int i = 0; i < emit_count; ++i) {
         float angle = angle_dist(rng);
         float speed = speed_dist(rng);
-        float life = life_dist(rng);
+        float particle_life = life_dist(rng);
         
         float vx = std::cos(angle) * speed;
         float vy = std::sin(angle) * speed;
@@ -41,17 +113,17 @@ void ParticleSystem::EmitFoodParticles(float x, float y, int count) {
         Uint8 g = static_cast<Uint8>(150 + (rng() % 105)); // 150-255
         Uint8 b = 0;
         
-        float size = 2.0f + static_cast<float>(rng() % 3);
+        float particle_size = 2.0f + static_cast<float>(rng() % 3);
         
-        particles.emplace_back(x, y, vx, vy, life, r, g, b, size);
+        Spawn(origin_x, origin_y, vx, vy, particle_life, r, g, b, particle_size);
     }
 }
 
-void ParticleSystem::EmitTrailParticles(float x, float y, int count) {
-    for (int i = 0; i < count; ++i) {
+void ParticleSystem::EmitTrailParticles(float origin_x, float origin_y, int emit_count) {
+    for (int i = 0; i < emit_count; ++i) {
         float angle = angle_dist(rng);
         float speed = speed_dist(rng) * 0.3f; // Slower particles
-        float life = life_dist(rng) * 0.5f;   // Shorter life
+        float particle_life = life_dist(rng) * 0.5f;   // Shorter life
         
         float vx = std::cos(angle) * speed;
         float vy = std::sin(angle) * speed;
@@ -61,49 +133,170 @@ void ParticleSystem::EmitTrailParticles(float x, float y, int count) {
         Uint8 g = static_cast<Uint8>(100 + (rng() % 155));
         Uint8 b = 255;
         
-        float size = 1.0f + static_cast<float>(rng() % 2);
+        float particle_size = 1.0f + static_cast<float>(rng() % 2);
+        
+        Spawn(origin_x, origin_y, vx, vy, particle_life, r, g, b, particle_size);
+    }
+}
+
+void ParticleSystem::EmitFireworkParticles(float origin_x, float origin_y, int emit_count) {
+    // Bright firework palette
+    static const Uint8 kPalette[][3] = {
+        {255, 80, 80}, {255, 200, 60}, {120, 255, 120}, {90, 180, 255}, {230, 120, 255}, {255, 255, 255}
+    };
+    const std::size_t palette_size = sizeof(kPalette) / sizeof(kPalette[0]);
+    for (int i = 0; i < emit_count; ++i) {
+        float angle = angle_dist(rng);
+        float speed = speed_dist(rng) * 1.5f; // Wide, fast burst
+        float particle_life = life_dist(rng);
+        
+        float vx = std::cos(angle) * speed;
+        float vy = std::sin(angle) * speed;
+        
+        const Uint8* color = kPalette[rng() % palette_size];
+        float particle_size = 1.0f + static_cast<float>(rng() % 3);
         
-        particles.emplace_back(x, y, vx, vy, life, r, g, b, size);
+        Spawn(origin_x, origin_y, vx, vy, particle_life, color[0], color[1], color[2], particle_size);
+    }
+}
+
+void ParticleSystem::Reserve(std::size_t new_capacity) {
+    if (new_capacity <= capacity) {
+        return;
+    }
+    for (AlignedFloats* array : {&x, &y, &velocity_x, &velocity_y, &death_time, &inv_max_life, &size}) {
+        array->Resize(count, new_capacity);
     }
+    color_r.resize(new_capacity);
+    color_g.resize(new_capacity);
+    color_b.resize(new_capacity);
+    capacity = new_capacity;
+}
+
+void ParticleSystem::Spawn(float px, float py, float vx, float vy, float particle_life,
+                           Uint8 r, Uint8 g, Uint8 b, float particle_size) {
+    if (count == capacity) {
+        return;  // Pool full
+    }
+    const std::size_t i = count++;
+    x[i] = px;
+    y[i] = py;
+    velocity_x[i] = vx;
+    velocity_y[i] = vy;
+    death_time[i] = clock + particle_life;
+    inv_max_life[i] = 1.0f / particle_life;
+    size[i] = particle_size;
+    color_r[i] = r;
+    color_g[i] = g;
+    color_b[i] = b;
+    next_death = std::min(next_death, death_time[i]);
+}
+
+void ParticleSystem::MoveParticle(std::size_t from, std::size_t to) {
+    x[to] = x[from];
+    y[to] = y[from];
+    velocity_x[to] = velocity_x[from];
+    velocity_y[to] = velocity_y[from];
+    death_time[to] = death_time[from];
+    inv_max_life[to] = inv_max_life[from];
+    size[to] = size[from];
+    color_r[to] = color_r[from];
+    color_g[to] = color_g[from];
+    color_b[to] = color_b[from];
 }
 
 void ParticleSystem::Update(float dt) {
-    // Update all particles
-    for (auto& particle : particles) {
-        particle.Update(dt);
+    // Update all particles, split across the worker pool for large counts
+    if (workers != nullptr && count >= kParallelThreshold) {
+        // Split on whole vector blocks so every particle takes the same
+        // (vector or scalar) path it would take sequentially
+        const std::size_t blocks = (count + kSimdBlock - 1) / kSimdBlock;
+        const std::size_t live = count;
+        workers->ParallelFor(blocks, kParallelGrain / kSimdBlock,
+                             [this, dt, live](std::size_t begin, std::size_t end) {
+            Integrate(x.get(), y.get(), velocity_x.get(), velocity_y.get(),
+                      begin * kSimdBlock, std::min(end * kSimdBlock, live), dt);
+        });
+    } else {
+        Integrate(x.get(), y.get(), velocity_x.get(), velocity_y.get(), 0, count, dt);
+    }
+    clock += dt;
+    last_dt = dt;
+
+    // Nothing to scan until the earliest death time has passed
+    if (clock >= next_death) {
+        RemoveDead();
+    }
+    integrated_count = count;
+
+    if (clock > kClockRebase) {
+        for (std::size_t i = 0; i < count; ++i) {
+            death_time[i] -= clock;
+        }
+        next_death -= clock;
+        clock = 0.0f;
     }
-    
-    // Remove dead particles
-    particles.erase(
-        std::remove_if(particles.begin(), particles.end(), 
-                      [](const Particle& p) { return !p.IsAlive(); }),
-        particles.end()
-    );
 }
 
-void ParticleSystem::Render(SDL_Renderer* renderer, int block_width, int block_height) {
-    for (const auto& particle : particles) {
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, particle.r, particle.g, particle.b, particle.a);
-        
+void ParticleSystem::RemoveDead() {
+    // Swap the last live particle into each hole
+    float earliest = std::numeric_limits<float>::infinity();
+    std::size_t i = 0;
+    while (i < count) {
+        if (death_time[i] > clock) {
+            earliest = std::min(earliest, death_time[i]);
+            ++i;
+            continue;
+        }
+        --count;
+        if (i != count) {
+            MoveParticle(count, i);
+        }
+    }
+    next_death = earliest;
+}
+
+void ParticleSystem::Render(RenderBatch& batch, int block_width, int block_height,
+                            const SDL_Rect& view, float alpha) {
+    // Fraction of the last step still to be undone to land between the
+    // previous and the current position
+    const float rewind = (1.0f - alpha) * last_dt;
+    const float rewind_fall = kGravity * last_dt;
+    // Board pixel of cell (0, 0)'s centre on screen
+    const float origin_x = static_cast<float>(block_width / 2 - view.x);
+    const float origin_y = static_cast<float>(block_height / 2 - view.y);
+    for (std::size_t i = 0; i < count; ++i) {
         // Convert grid coordinates to screen coordinates
-        int screen_x = static_cast<int>(particle.x * block_width + block_width / 2);
-        int screen_y = static_cast<int>(particle.y * block_height + block_height / 2);
+        float px = x[i];
+        float py = y[i];
+        if (i < integrated_count) {
+            px -= velocity_x[i] * rewind;
+            py -= (velocity_y[i] - rewind_fall) * rewind;
+        }
+        int screen_x = static_cast<int>(px * block_width + origin_x);
+        int screen_y = static_cast<int>(py * block_height + origin_y);
         
-        // Draw particle as a small filled rectangle
+        // Draw particle as a small filled rectangle; all of them share one
+        // blend state, so the batch submits them in a single draw
         SDL_Rect rect;
-        rect.x = screen_x - static_cast<int>(particle.size / 2);
-        rect.y = screen_y - static_cast<int>(particle.size / 2);
-        rect.w = static_cast<int>(particle.size);
-        rect.h = static_cast<int>(particle.size);
+        rect.x = screen_x - static_cast<int>(size[i] / 2);
+        rect.y = screen_y - static_cast<int>(size[i] / 2);
+        rect.w = static_cast<int>(size[i]);
+        rect.h = static_cast<int>(size[i]);
+        if (rect.x + rect.w <= 0 || rect.y + rect.h <= 0 ||
+            rect.x >= view.w || rect.y >= view.h) {
+            continue;
+        }
         
-        SDL_RenderFillRect(renderer, &rect);
+        // Fade out as particle dies
+        float opacity = std::min(1.0f, (death_time[i] - clock) * inv_max_life[i]);
+        Uint8 a = static_cast<Uint8>(opacity * 255);
+        batch.FillRect(rect, SDL_Color{color_r[i], color_g[i], color_b[i], a});
     }
-    
-    // Reset blend mode
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
 
 void ParticleSystem::Clear() {
-    particles.clear();
-}
\ No newline at end of file
+    count = 0;
+    integrated_count = 0;
+    next_death = std::numeric_limits<float>::infinity();
+}
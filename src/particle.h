@@ -15,6 +15,8 @@
  * 
  * Key Features:
  * - Real-time physics simulation with gravity and velocity
+ * - Structure-of-arrays pool with a SIMD (SSE/AVX) integration kernel
+ * - Deterministic multithreaded updates for high-density effects
  * - Dynamic particle emission and lifecycle management
  * - Alpha blending and transparency effects
  * - Optimized rendering for smooth 60+ FPS performance
@@ -27,51 +29,115 @@
 #define PARTICLE_H
 
 #include "SDL.h"
+#include "render_batch.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <vector>
 #include <random>
 
-struct Particle {
-    float x, y;
-    float velocity_x, velocity_y;
-    float life;
-    float max_life;
-    Uint8 r, g, b, a;
-    float size;
-    
-    Particle(float x, float y, float vx, float vy, float life, Uint8 r, Uint8 g, Uint8 b, float size)
-        : x(x), y(y), velocity_x(vx), velocity_y(vy), life(life), max_life(life), 
-          r(r), g(g), b(b), a(255), size(size) {}
-    
-    void Update(float dt) {
-        x += velocity_x * dt;
-        y += velocity_y * dt;
-        life -= dt;
-        
-        // Fade out as particle dies
-        a = static_cast<Uint8>((life / max_life) * 255);
-        
-        // Gravity effect
-        velocity_y += 50.0f * dt;
-    }
-    
-    bool IsAlive() const {
-        return life > 0;
+class WorkStealingPool;
+
+// Fixed-size float array aligned for full-width SIMD loads and stores.
+class AlignedFloats {
+public:
+    static constexpr std::size_t kAlignment = 32;
+
+    explicit AlignedFloats(std::size_t count)
+        : data(static_cast<float*>(::operator new(count * sizeof(float), std::align_val_t{kAlignment}))) {}
+    ~AlignedFloats() { ::operator delete(data, std::align_val_t{kAlignment}); }
+    AlignedFloats(const AlignedFloats&) = delete;
+    AlignedFloats& operator=(const AlignedFloats&) = delete;
+
+    float& operator[](std::size_t i) { return data[i]; }
+    float operator[](std::size_t i) const { return data[i]; }
+    float* get() { return data; }
+    const float* get() const { return data; }
+
+    // Reallocates to `count` floats, keeping the first `keep`.
+    void Resize(std::size_t keep, std::size_t count) {
+        float* grown = static_cast<float*>(::operator new(count * sizeof(float), std::align_val_t{kAlignment}));
+        std::copy(data, data + keep, grown);
+        ::operator delete(data, std::align_val_t{kAlignment});
+        data = grown;
     }
+
+private:
+    float* data;
 };
 
+// Fixed-capacity structure-of-arrays particle pool. Each attribute lives in
+// its own aligned array so Update() can integrate several particles per
+// instruction; dead particles are removed by moving the last live one into
+// their slot, so the live range is always [0, Count()).
+//
+// To keep the per-step memory traffic low, remaining life is not stored:
+// each particle records the pool time at which it dies, and the previous
+// position used for interpolation is recovered from the velocity and the
+// last step length instead of being copied every step.
+//
+// With a worker pool attached, Update() splits integration across threads
+// once the live count reaches kParallelThreshold. Every particle is
+// integrated independently and dead ones are removed sequentially
+// afterwards, so the result is identical to the single-threaded path.
 class ParticleSystem {
 public:
-    ParticleSystem();
+    static constexpr std::size_t kDefaultCapacity = 131072;
+    static constexpr std::size_t kParallelThreshold = 32768;
+    static constexpr std::size_t kParallelGrain = 16384;
+
+    explicit ParticleSystem(std::size_t capacity = kDefaultCapacity,
+                            std::uint32_t seed = std::random_device{}());
     ~ParticleSystem() = default;
+
+    // Grows the pool (never shrinks it); live particles are kept.
+    void Reserve(std::size_t new_capacity);
+    // Pool used for large updates; nullptr keeps everything on the caller.
+    void SetWorkerPool(WorkStealingPool* pool) { workers = pool; }
     
+    // Emitters drop particles that do not fit in the pool.
     void EmitFoodParticles(float x, float y, int count = 15);
     void EmitTrailParticles(float x, float y, int count = 3);
+    void EmitFireworkParticles(float x, float y, int count);
     void Update(float dt);
-    void Render(SDL_Renderer* renderer, int block_width, int block_height);
+    // Queues particles `alpha` (0-1) of the way from their previous to their
+    // current simulated position into `batch`. `view` is the visible part of
+    // the board in board pixels; particles outside it are skipped and the
+    // rest are drawn relative to its corner.
+    void Render(RenderBatch& batch, int block_width, int block_height,
+                const SDL_Rect& view, float alpha = 1.0f);
     void Clear();
+
+    std::size_t Count() const { return count; }
+    std::size_t Capacity() const { return capacity; }
     
 private:
-    std::vector<Particle> particles;
+    void Spawn(float x, float y, float vx, float vy, float life, Uint8 r, Uint8 g, Uint8 b, float size);
+    // Drops every particle whose death time has passed.
+    void RemoveDead();
+    // Moves particle `from` into slot `to`.
+    void MoveParticle(std::size_t from, std::size_t to);
+
+    WorkStealingPool* workers;
+
+    std::size_t capacity;
+    std::size_t count;
+    // Particles below this index have been through at least one Update()
+    // and can be interpolated; newer ones are drawn where they spawned.
+    std::size_t integrated_count;
+
+    float clock;         // Pool time in seconds, rebased now and then
+    float last_dt;       // Length of the last Update() step
+    float next_death;    // Earliest death time of any live particle
+
+    AlignedFloats x, y;
+    AlignedFloats velocity_x, velocity_y;
+    AlignedFloats death_time;
+    AlignedFloats inv_max_life;  // Opacity is (death_time - clock) * inv_max_life
+    AlignedFloats size;
+    std::vector<Uint8> color_r, color_g, color_b;
+
     std::mt19937 rng;
     std::uniform_real_distribution<float> angle_dist;
     std::uniform_real_distribution<float> speed_dist;
@@ -0,0 +1,32 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Grid Coordinate Type
+ * ============================================================================
+ * 
+ * File: point.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Plain integer cell coordinate used by the simulation core in place of
+ * SDL_Point, so the rules compile without any SDL headers.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef POINT_H
+#define POINT_H
+
+struct Point {
+  int x;
+  int y;
+};
+
+inline bool operator==(Point const &a, Point const &b) {
+  return a.x == b.x && a.y == b.y;
+}
+inline bool operator!=(Point const &a, Point const &b) { return !(a == b); }
+
+#endif
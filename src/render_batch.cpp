@@ -0,0 +1,125 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Batched Geometry Submission Implementation
+ * ============================================================================
+ *
+ * File: render_batch.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "render_batch.h"
+
+namespace {
+
+// Initial room for quads; the arrays grow on demand and keep their capacity.
+constexpr std::size_t kReservedQuads{4096};
+
+}  // namespace
+
+RenderBatch::RenderBatch() {
+  vertices.reserve(kReservedQuads * 4);
+  indices.reserve(kReservedQuads * 6);
+}
+
+void RenderBatch::SetRenderer(SDL_Renderer *target) {
+  renderer = target;
+  texture = nullptr;
+  draw_blend_known = false;
+  vertices.clear();
+  indices.clear();
+}
+
+void RenderBatch::FillRect(SDL_FRect const &rect, SDL_Color color,
+                           SDL_BlendMode blend_mode) {
+  if (rect.w <= 0.0f || rect.h <= 0.0f) {
+    return;
+  }
+  SetState(nullptr, blend_mode);
+  PushQuad(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, 0.0f, 0.0f, 0.0f,
+           0.0f, color);
+}
+
+void RenderBatch::FillRect(SDL_Rect const &rect, SDL_Color color,
+                           SDL_BlendMode blend_mode) {
+  SDL_FRect const frect = {static_cast<float>(rect.x),
+                           static_cast<float>(rect.y),
+                           static_cast<float>(rect.w),
+                           static_cast<float>(rect.h)};
+  FillRect(frect, color, blend_mode);
+}
+
+void RenderBatch::Copy(SDL_Texture *source_texture, int texture_width,
+                       int texture_height, SDL_Rect const *source,
+                       SDL_Rect const &dest, SDL_Color tint) {
+  if (source_texture == nullptr || dest.w <= 0 || dest.h <= 0 ||
+      texture_width <= 0 || texture_height <= 0) {
+    return;
+  }
+  SetState(source_texture, blend);
+
+  float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+  if (source != nullptr) {
+    float const inv_w = 1.0f / texture_width;
+    float const inv_h = 1.0f / texture_height;
+    u0 = source->x * inv_w;
+    v0 = source->y * inv_h;
+    u1 = (source->x + source->w) * inv_w;
+    v1 = (source->y + source->h) * inv_h;
+  }
+  PushQuad(static_cast<float>(dest.x), static_cast<float>(dest.y),
+           static_cast<float>(dest.x + dest.w),
+           static_cast<float>(dest.y + dest.h), u0, v0, u1, v1, tint);
+}
+
+void RenderBatch::Flush() {
+  if (indices.empty()) {
+    return;
+  }
+  if (renderer == nullptr) {
+    vertices.clear();
+    indices.clear();
+    return;
+  }
+  if (texture == nullptr && (!draw_blend_known || draw_blend != blend)) {
+    SDL_SetRenderDrawBlendMode(renderer, blend);
+    draw_blend = blend;
+    draw_blend_known = true;
+  }
+  SDL_RenderGeometry(renderer, texture, vertices.data(),
+                     static_cast<int>(vertices.size()), indices.data(),
+                     static_cast<int>(indices.size()));
+  ++draw_calls;
+  vertices.clear();
+  indices.clear();
+}
+
+void RenderBatch::SetState(SDL_Texture *next_texture,
+                           SDL_BlendMode next_blend) {
+  // Textured runs take their blend mode from the texture, so only the
+  // texture identity matters for them.
+  bool const same = next_texture == texture &&
+                    (next_texture != nullptr || next_blend == blend);
+  if (same) {
+    return;
+  }
+  Flush();
+  texture = next_texture;
+  blend = next_blend;
+}
+
+void RenderBatch::PushQuad(float x0, float y0, float x1, float y1, float u0,
+                           float v0, float u1, float v1, SDL_Color color) {
+  int const base = static_cast<int>(vertices.size());
+  vertices.push_back({{x0, y0}, color, {u0, v0}});
+  vertices.push_back({{x1, y0}, color, {u1, v0}});
+  vertices.push_back({{x1, y1}, color, {u1, v1}});
+  vertices.push_back({{x0, y1}, color, {u0, v1}});
+  indices.insert(indices.end(),
+                 {base, base + 1, base + 2, base, base + 2, base + 3});
+  ++quads;
+}
@@ -0,0 +1,91 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Batched Geometry Submission
+ * ============================================================================
+ *
+ * File: render_batch.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * Collects coloured and textured quads into a vertex/index array and
+ * submits them with one SDL_RenderGeometry call per run of identical
+ * render state (texture plus blend mode). Draw order is preserved: a
+ * state change simply closes the current run.
+ *
+ * Every draw in the renderer goes through one RenderBatch, so the number
+ * of renderer calls per frame depends on how often the state changes
+ * (background, sprites, text, particles, overlay), not on how long the
+ * snake is or how many particles are alive. Redundant blend mode changes
+ * are skipped.
+ *
+ * Requires SDL 2.0.18 or newer for SDL_RenderGeometry.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef RENDER_BATCH_H
+#define RENDER_BATCH_H
+
+#include <cstddef>
+#include <vector>
+#include "SDL.h"
+
+class RenderBatch {
+ public:
+  RenderBatch();
+
+  // Binds the batch to `renderer`; anything pending is discarded.
+  void SetRenderer(SDL_Renderer *renderer);
+
+  // Solid quad. Untextured geometry uses the renderer's draw blend mode,
+  // which the batch sets only when it differs from the last one applied.
+  void FillRect(SDL_FRect const &rect, SDL_Color color,
+                SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+  void FillRect(SDL_Rect const &rect, SDL_Color color,
+                SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+  // Textured quad: `source` (nullptr = whole texture) of a texture that is
+  // `texture_width` x `texture_height` pixels, modulated by `tint`. The
+  // texture's own blend mode applies.
+  void Copy(SDL_Texture *texture, int texture_width, int texture_height,
+            SDL_Rect const *source, SDL_Rect const &dest,
+            SDL_Color tint = SDL_Color{255, 255, 255, 255});
+
+  // Submits pending geometry. Call before presenting, and before drawing
+  // to the renderer directly.
+  void Flush();
+
+  // Geometry submissions and quads queued since the last ResetStats().
+  std::size_t DrawCalls() const { return draw_calls; }
+  std::size_t Quads() const { return quads; }
+  void ResetStats() {
+    draw_calls = 0;
+    quads = 0;
+  }
+
+ private:
+  void SetState(SDL_Texture *texture, SDL_BlendMode blend);
+  void PushQuad(float x0, float y0, float x1, float y1, float u0, float v0,
+                float u1, float v1, SDL_Color color);
+
+  SDL_Renderer *renderer{nullptr};
+
+  // State of the pending run.
+  SDL_Texture *texture{nullptr};
+  SDL_BlendMode blend{SDL_BLENDMODE_BLEND};
+
+  // Draw blend mode last set on the renderer; `draw_blend_known` is false
+  // until the batch has set it once.
+  SDL_BlendMode draw_blend{SDL_BLENDMODE_NONE};
+  bool draw_blend_known{false};
+
+  std::vector<SDL_Vertex> vertices;
+  std::vector<int> indices;
+  std::size_t draw_calls{0};
+  std::size_t quads{0};
+};
+
+#endif
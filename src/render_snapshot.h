@@ -0,0 +1,94 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Render Snapshot
+ * ============================================================================
+ * 
+ * File: render_snapshot.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Immutable copy of everything the renderer needs from one simulation
+ * tick: snake body and head, food, score, state, and a short history of
+ * gameplay events that trigger particles and sounds. The simulation thread
+ * fills one after each tick and publishes it through a triple buffer, so
+ * the render thread never reads live simulation state.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include "game_state.h"
+#include "point.h"
+
+struct SnapshotEvent {
+  enum class Type { kAteFood, kDied, kWon };
+
+  Type type{Type::kAteFood};
+  Point cell{0, 0};
+};
+
+struct RenderSnapshot {
+  // Events are numbered from 1 across the whole run. The snapshot carries
+  // the most recent kEventHistory of them, so a reader that skipped a few
+  // snapshots can still catch up on what it missed.
+  static constexpr std::size_t kEventHistory{32};
+
+  // Tail first, excluding the head. A deque so that publishing can drop
+  // the vacated tail and append the new neck in place.
+  std::deque<Point> body;
+  // Sequence number one past the neck: body[i] is segment
+  // body_end_seq - body.size() + i. See Snake::body_pushes.
+  std::uint64_t body_end_seq{0};
+  float head_x{0.0f};
+  float head_y{0.0f};
+  float prev_head_x{0.0f};
+  float prev_head_y{0.0f};
+  bool alive{true};
+  Point food{0, 0};
+  int score{0};
+  GameState state{GameState::StartScreen};
+
+  std::uint64_t tick{0};        // Simulation ticks completed.
+  std::uint64_t tick_time{0};   // Performance counter when `tick` ended.
+
+  std::uint64_t event_count{0};
+  std::array<SnapshotEvent, kEventHistory> events{};  // Indexed by seq % size.
+
+  // Where to draw the head, in cells, a fraction `alpha` of a tick after
+  // `tick`. The head slides across each cell in its direction of travel
+  // from the edge it entered by, so it leads its cell and never sits on
+  // the neck. Across its direction of travel it stays on its cell's
+  // column or row, whatever fraction a mid-cell turn left behind.
+  void InterpolatedHead(float alpha, float &x, float &y) const {
+    float const dx = head_x - prev_head_x;
+    float const dy = head_y - prev_head_y;
+    x = dx != 0.0f ? head_x : std::floor(head_x);
+    y = dy != 0.0f ? head_y : std::floor(head_y);
+    // Blend only when the last step did not wrap around the board edge.
+    if (dx != 0.0f && std::fabs(dx) < 1.0f) {
+      x = prev_head_x + dx * alpha;
+    }
+    if (dy != 0.0f && std::fabs(dy) < 1.0f) {
+      y = prev_head_y + dy * alpha;
+    }
+    // Moving left or up, the cell is entered at its far edge. A wrap
+    // reverses the sign of the step.
+    if ((dx < 0.0f) != (std::fabs(dx) >= 1.0f) && dx != 0.0f) {
+      x -= 1.0f;
+    }
+    if ((dy < 0.0f) != (std::fabs(dy) >= 1.0f) && dy != 0.0f) {
+      y -= 1.0f;
+    }
+  }
+};
+
+#endif
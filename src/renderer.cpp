@@ -19,6 +19,7 @@
  * - Advanced color blending and transparency
  * - Optimized drawing algorithms for 60+ FPS performance
  * - Professional UI/UX design implementation
+ * - Viewport culling, so large boards cost no more than the window shows
  * 
  * Copyright (c) 2025 Your Name. All rights reserved.
  * ============================================================================
@@ -29,8 +30,35 @@
 #include <string>
 #include <cmath>
 #include <algorithm>
-#include <map>
-#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+// Fireworks stress mode sizes.
+constexpr std::size_t kFireworksCapacity{1 << 20};
+constexpr int kFireworksFoodBurst{20000};
+constexpr int kFireworksDeathBurst{60000};
+
+// Longest side of the minimap and its distance from the window corner.
+constexpr int kMinimapPixels{128};
+constexpr int kMinimapMargin{10};
+
+// Content blended onto a transparent render target ends up premultiplied
+// by alpha, so cached layers are composited with a premultiplied blend.
+// Renderers without custom blend modes get ordinary blending, which
+// slightly darkens anti-aliased edges.
+void SetPremultipliedBlend(SDL_Texture *texture) {
+  SDL_BlendMode const premultiplied = SDL_ComposeCustomBlendMode(
+      SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+      SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE,
+      SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+  if (SDL_SetTextureBlendMode(texture, premultiplied) != 0) {
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  }
+}
+
+}  // namespace
 
 Renderer::Renderer(const std::size_t screen_width,
                    const std::size_t screen_height,
@@ -39,7 +67,17 @@ Renderer::Renderer(const std::size_t screen_width,
       screen_height(screen_height),
       grid_width(grid_width),
       grid_height(grid_height),
-      animation_time(0.0f) {
+      cell_width(std::max(static_cast<int>(screen_width / grid_width),
+                          kCameraCellPixels)),
+      cell_height(std::max(static_cast<int>(screen_height / grid_height),
+                           kCameraCellPixels)),
+      scrolling_camera(cell_width * grid_width > screen_width ||
+                       cell_height * grid_height > screen_height),
+      camera{0, 0, static_cast<int>(screen_width),
+             static_cast<int>(screen_height)},
+      animation_time(0.0f),
+      interpolation_alpha(1.0f),
+      snake_map(static_cast<int>(grid_width), static_cast<int>(grid_height)) {
   // Initialize SDL
   if (SDL_Init(SDL_INIT_VIDEO) < 0) {
     std::cerr << "SDL could not initialize.\n";
@@ -57,21 +95,48 @@ Renderer::Renderer(const std::size_t screen_width,
   }
 
   // Create renderer
-  sdl_renderer = SDL_CreateRenderer(sdl_window, -1, SDL_RENDERER_ACCELERATED);
+  sdl_renderer = SDL_CreateRenderer(sdl_window, -1,
+                                    SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
   if (nullptr == sdl_renderer) {
     std::cerr << "Renderer could not be created.\n";
     std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
   }
+
+  sprite_atlas.SetTarget(sdl_renderer, cell_width, cell_height);
+  bitmap_font.Bake(sdl_renderer);
+  batch.SetRenderer(sdl_renderer);
+  particle_system.SetWorkerPool(&particle_workers);
 }
 
 Renderer::~Renderer() {
+  bitmap_font.Release();
+  sprite_atlas.Release();
+  if (background_texture != nullptr) {
+    SDL_DestroyTexture(background_texture);
+  }
+  if (snake_layer_texture != nullptr) {
+    SDL_DestroyTexture(snake_layer_texture);
+  }
+  if (minimap_texture != nullptr) {
+    SDL_DestroyTexture(minimap_texture);
+  }
+  ReleaseOverlay(start_overlay);
+  ReleaseOverlay(pause_overlay);
+  ReleaseOverlay(game_over_overlay);
   SDL_DestroyWindow(sdl_window);
   SDL_Quit();
 }
 
-void Renderer::Render(Snake const snake, SDL_Point const &food, int score, GameState game_state) {
-  // Update animation time
-  animation_time += 0.016f; // Assuming ~60 FPS
+void Renderer::Render(RenderSnapshot const &snapshot, float alpha, float frame_seconds) {
+  GameState const game_state = snapshot.state;
+  Point const &food = snapshot.food;
+  int const score = snapshot.score;
+
+  // Update animation time from the real frame duration
+  animation_time += frame_seconds;
+  interpolation_alpha = alpha;
+  sprite_atlas.SetTarget(sdl_renderer, cell_width, cell_height);
+  UpdateCamera(snapshot);
   
   // Clear screen with gradient background
   RenderGradientBackground();
@@ -84,35 +149,92 @@ void Renderer::Render(Snake const snake, SDL_Point const &food, int score, GameS
     RenderGlowingFood(food);
     
     // Render enhanced snake with smooth segments
-    RenderEnhancedSnake(snake);
+    RenderEnhancedSnake(snapshot);
     
     // Render score card at the top
     RenderScoreCard(score);
+    RenderMinimap(snapshot);
   } else if (game_state == GameState::Paused) {
     // Render game in paused state
     RenderGlowingFood(food);
-    RenderEnhancedSnake(snake);
+    RenderEnhancedSnake(snapshot);
     RenderScoreCard(score);
+    RenderMinimap(snapshot);
     
     // Render pause overlay
     RenderPauseOverlay();
-  } else if (game_state == GameState::GameOver) {
-    // Render the dead snake
-    RenderEnhancedSnake(snake);
+  } else if (game_state == GameState::GameOver || game_state == GameState::Won) {
+    // Render the final snake
+    RenderEnhancedSnake(snapshot);
     
-    // Render game over screen
-    RenderGameOverScreen(score);
+    // Render game over (or board cleared) screen
+    RenderGameOverScreen(score, game_state == GameState::Won);
   }
   
-  // Update and render particle effects
-  particle_system.Update(0.016f);
-  SDL_Rect block;
-  block.w = screen_width / grid_width;
-  block.h = screen_height / grid_height;
-  particle_system.Render(sdl_renderer, block.w, block.h);
+  // Render particle effects (stepped once per simulation tick by Game)
+  particle_system.Render(batch, cell_width, cell_height, camera, alpha);
+}
 
-  // Update Screen
+void Renderer::Present() {
+  // Submit the queued geometry, then update Screen
+  batch.Flush();
   SDL_RenderPresent(sdl_renderer);
+  last_frame_draw_calls = batch.DrawCalls();
+  batch.ResetStats();
+  bitmap_font.EndFrame();
+}
+
+void Renderer::RenderPerfOverlay(FrameStats const &stats) {
+  constexpr int kPanelWidth = 300;
+  constexpr int kRowHeight = 12;
+  constexpr int kGraphHeight = 60;
+  constexpr float kGraphMs = 33.3f;  // Full graph height (two 60 Hz frames)
+  int const panel_x = static_cast<int>(screen_width) - kPanelWidth - 10;
+  int const panel_y = 10;
+  int const rows = static_cast<int>(FrameStats::kPhaseCount) + 3;
+  int const panel_height = rows * kRowHeight + kGraphHeight + 24;
+
+  SDL_Rect panel = {panel_x, panel_y, kPanelWidth, panel_height};
+  batch.FillRect(panel, SDL_Color{0, 0, 0, 170});
+
+  // Percentile table, one row per phase plus the whole frame
+  auto format_row = [](char const *name, PhaseSummary const &summary) {
+    char line[64];
+    std::snprintf(line, sizeof(line), "%-7s %5.2f %5.2f %5.2f %5.2f", name,
+                  summary.p50, summary.p95, summary.p99, summary.max);
+    return std::string(line);
+  };
+  int text_y = panel_y + 8;
+  // The figures change every refresh, so skip the run cache
+  bitmap_font.DrawText(batch, "PHASE     P50   P95   P99   MAX", panel_x + 8, text_y, 1);
+  for (std::size_t i = 0; i < FrameStats::kPhaseCount; ++i) {
+    FramePhase const phase = static_cast<FramePhase>(i);
+    text_y += kRowHeight;
+    bitmap_font.DrawText(batch, format_row(FrameStats::PhaseName(phase), stats.Phase(phase)),
+                         panel_x + 8, text_y, 1);
+  }
+  text_y += kRowHeight;
+  bitmap_font.DrawText(batch, format_row("frame", stats.Total()), panel_x + 8, text_y, 1);
+  text_y += kRowHeight;
+  bitmap_font.DrawText(batch, "DRAW CALLS: " + std::to_string(last_frame_draw_calls) +
+                                  "  PARTICLES: " + std::to_string(particle_system.Count()),
+                       panel_x + 8, text_y, 1);
+
+  // Frame time graph, newest frame on the right, one bar per pixel column
+  int const graph_x = panel_x + 8;
+  int const graph_y = text_y + kRowHeight + 4;
+  int const graph_width = kPanelWidth - 16;
+  for (int column = 0; column < graph_width; ++column) {
+    float const ms = stats.RecentTotal(static_cast<std::size_t>(graph_width - 1 - column));
+    int const height = std::min(kGraphHeight, static_cast<int>(ms / kGraphMs * kGraphHeight));
+    SDL_Rect const bar = {graph_x + column, graph_y + kGraphHeight - height, 1, height};
+    batch.FillRect(bar, SDL_Color{100, 255, 100, 200});
+  }
+
+  // 60 Hz budget line
+  int const budget_y = graph_y + kGraphHeight - static_cast<int>(16.7f / kGraphMs * kGraphHeight);
+  SDL_Rect const budget = {graph_x, budget_y, graph_width + 1, 1};
+  batch.FillRect(budget, SDL_Color{255, 100, 100, 220});
 }
 
 void Renderer::UpdateWindowTitle(int score, int fps) {
@@ -121,58 +243,157 @@ void Renderer::UpdateWindowTitle(int score, int fps) {
 }
 
 void Renderer::EmitFoodParticles(float x, float y) {
-  particle_system.EmitFoodParticles(x, y);
+  if (fireworks_mode) {
+    particle_system.EmitFireworkParticles(x, y, kFireworksFoodBurst);
+  } else {
+    particle_system.EmitFoodParticles(x, y);
+  }
+}
+
+void Renderer::EmitDeathParticles(float x, float y) {
+  // Only the stress mode marks the crash site
+  if (fireworks_mode) {
+    particle_system.EmitFireworkParticles(x, y, kFireworksDeathBurst);
+  }
+}
+
+void Renderer::SetFireworksMode(bool enabled) {
+  fireworks_mode = enabled;
+  if (enabled) {
+    particle_system.Reserve(kFireworksCapacity);
+  }
+}
+
+void Renderer::InvalidateRenderTargets() {
+  snake_layer.Invalidate();
+  start_overlay.valid = false;
+  pause_overlay.valid = false;
+  game_over_overlay.valid = false;
+  minimap_valid = false;
 }
 
 void Renderer::UpdateParticles(float dt) {
   particle_system.Update(dt);
 }
 
+void Renderer::SetBackgroundTheme(BackgroundTheme const &theme) {
+  background_theme = theme;
+  background_width = 0;  // Forces a rebuild on the next frame
+}
+
 void Renderer::RenderGradientBackground() {
-  // Create a nature-inspired gradient background
-  for (int y = 0; y < static_cast<int>(screen_height); ++y) {
-    float ratio = static_cast<float>(y) / screen_height;
-    
-    // Dark forest green to lighter green gradient
-    Uint8 r = static_cast<Uint8>(10 + ratio * 30);  // 10-40
-    Uint8 g = static_cast<Uint8>(20 + ratio * 60);  // 20-80
-    Uint8 b = static_cast<Uint8>(15 + ratio * 25);  // 15-40
-    
-    SDL_SetRenderDrawColor(sdl_renderer, r, g, b, 255);
-    SDL_RenderDrawLine(sdl_renderer, 0, y, screen_width, y);
+  // Create a nature-inspired gradient background, baked once and blitted
+  // with a single copy per frame
+  int width = static_cast<int>(screen_width);
+  int height = static_cast<int>(screen_height);
+  SDL_GetRendererOutputSize(sdl_renderer, &width, &height);
+  if (background_texture == nullptr || width != background_width ||
+      height != background_height) {
+    RebuildBackgroundTexture(width, height);
+  }
+
+  if (background_texture != nullptr) {
+    SDL_Rect const screen = {0, 0, width, height};
+    batch.Copy(background_texture, 1, height, nullptr, screen);
+  } else {
+    // Texture creation failed; clear to the top colour rather than nothing
+    SDL_Rect const screen = {0, 0, width, height};
+    batch.FillRect(screen, background_theme.top, SDL_BLENDMODE_NONE);
   }
 }
 
+void Renderer::RebuildBackgroundTexture(int width, int height) {
+  if (background_texture != nullptr) {
+    SDL_DestroyTexture(background_texture);
+    background_texture = nullptr;
+  }
+  background_width = width;
+  background_height = height;
+  if (height <= 0) {
+    return;
+  }
+
+  // Every row is a single colour, so one column at the output height holds
+  // the whole gradient; stretching it horizontally is exact under any
+  // scale filter.
+  SDL_Color const &top = background_theme.top;
+  SDL_Color const &bottom = background_theme.bottom;
+  std::vector<Uint32> column(height);
+  for (int y = 0; y < height; ++y) {
+    float ratio = static_cast<float>(y) / height;
+
+    // Dark forest green to lighter green gradient by default
+    Uint8 r = static_cast<Uint8>(top.r + ratio * (bottom.r - top.r));
+    Uint8 g = static_cast<Uint8>(top.g + ratio * (bottom.g - top.g));
+    Uint8 b = static_cast<Uint8>(top.b + ratio * (bottom.b - top.b));
+
+    column[y] = 0xFF000000u | (static_cast<Uint32>(r) << 16) |
+                (static_cast<Uint32>(g) << 8) | b;
+  }
+
+  background_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                         SDL_TEXTUREACCESS_STATIC, 1, height);
+  if (background_texture == nullptr) {
+    std::cerr << "Background texture could not be created.\n";
+    std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+    return;
+  }
+  SDL_SetTextureBlendMode(background_texture, SDL_BLENDMODE_NONE);
+  SDL_UpdateTexture(background_texture, nullptr, column.data(),
+                    static_cast<int>(sizeof(Uint32)));
+}
+
 void Renderer::RenderRoundedRect(SDL_Rect rect, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, r, g, b, a);
-  
-  // Draw the main rectangle body
-  SDL_Rect body = {rect.x, rect.y + radius, rect.w, rect.h - 2 * radius};
-  SDL_RenderFillRect(sdl_renderer, &body);
-  
-  SDL_Rect top = {rect.x + radius, rect.y, rect.w - 2 * radius, radius};
-  SDL_RenderFillRect(sdl_renderer, &top);
-  
-  SDL_Rect bottom = {rect.x + radius, rect.y + rect.h - radius, rect.w - 2 * radius, radius};
-  SDL_RenderFillRect(sdl_renderer, &bottom);
-  
-  // Draw rounded corners with circles
-  DrawCircle(rect.x + radius, rect.y + radius, radius, r, g, b, a);
-  DrawCircle(rect.x + rect.w - radius, rect.y + radius, radius, r, g, b, a);
-  DrawCircle(rect.x + radius, rect.y + rect.h - radius, radius, r, g, b, a);
-  DrawCircle(rect.x + rect.w - radius, rect.y + rect.h - radius, radius, r, g, b, a);
-  
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
+  // One tinted copy of the pre-rasterized shape
+  if (sprite_atlas.DrawRoundedRect(batch, rect, radius, SDL_Color{r, g, b, a})) {
+    return;
+  }
+
+  // Atlas unavailable: fall back to a plain rectangle
+  batch.FillRect(rect, SDL_Color{r, g, b, a});
+}
+
+void Renderer::UpdateCamera(RenderSnapshot const &snapshot) {
+  if (!scrolling_camera) {
+    return;
+  }
+
+  // Centre the view on the head, stopping at the board edges
+  float head_x;
+  float head_y;
+  snapshot.InterpolatedHead(interpolation_alpha, head_x, head_y);
+  int const board_width = cell_width * static_cast<int>(grid_width);
+  int const board_height = cell_height * static_cast<int>(grid_height);
+  int const x = static_cast<int>((head_x + 0.5f) * cell_width) - camera.w / 2;
+  int const y = static_cast<int>((head_y + 0.5f) * cell_height) - camera.h / 2;
+  camera.x = std::max(0, std::min(x, board_width - camera.w));
+  camera.y = std::max(0, std::min(y, board_height - camera.h));
+}
+
+void Renderer::RenderRoundedBar(SDL_Rect rect, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+  // Three tinted copies of one short sprite whatever the length
+  if (sprite_atlas.DrawRoundedBar(batch, rect, radius, SDL_Color{r, g, b, a})) {
+    return;
+  }
+
+  // Atlas unavailable: fall back to a plain rectangle
+  batch.FillRect(rect, SDL_Color{r, g, b, a});
 }
 
-void Renderer::RenderGlowingFood(SDL_Point const &food) {
+void Renderer::RenderGlowingFood(Point const &food) {
   SDL_Rect block;
-  block.w = screen_width / grid_width;
-  block.h = screen_height / grid_height;
+  block.w = cell_width;
+  block.h = cell_height;
   
-  int center_x = food.x * block.w + block.w / 2;
-  int center_y = food.y * block.h + block.h / 2;
+  int center_x = food.x * block.w + block.w / 2 - camera.x;
+  int center_y = food.y * block.h + block.h / 2 - camera.y;
+
+  // Skip food whose outermost glow layer is off screen
+  int const reach = block.w / 2 + 9;
+  if (center_x + reach < 0 || center_y + reach < 0 ||
+      center_x - reach >= camera.w || center_y - reach >= camera.h) {
+    return;
+  }
   
   // Pulsing glow effect
   float pulse = (std::sin(animation_time * 4.0f) + 1.0f) / 2.0f; // 0-1
@@ -196,47 +417,35 @@ void Renderer::RenderGlowingFood(SDL_Point const &food) {
   }
 }
 
-void Renderer::RenderEnhancedSnake(Snake const snake) {
+void Renderer::RenderEnhancedSnake(RenderSnapshot const &snapshot) {
   SDL_Rect block;
-  block.w = screen_width / grid_width;
-  block.h = screen_height / grid_height;
-  
-  // Render snake body with gradient and rounded segments
-  for (size_t i = 0; i < snake.body.size(); ++i) {
-    SDL_Point const &point = snake.body[i];
-    
-    // Create gradient from tail to head
-    float ratio = static_cast<float>(i) / std::max(1.0f, static_cast<float>(snake.body.size() - 1));
-    
-    // Green gradient for body
-    Uint8 r = static_cast<Uint8>(30 + ratio * 40);   // 30-70
-    Uint8 g = static_cast<Uint8>(120 + ratio * 135);  // 120-255
-    Uint8 b = static_cast<Uint8>(30 + ratio * 40);   // 30-70
-    
-    SDL_Rect segment_rect;
-    segment_rect.x = point.x * block.w + 2;
-    segment_rect.y = point.y * block.h + 2;
-    segment_rect.w = block.w - 4;
-    segment_rect.h = block.h - 4;
-    
-    // Draw rounded rectangle with shadow
-    SDL_Rect shadow = {segment_rect.x + 2, segment_rect.y + 2, segment_rect.w, segment_rect.h};
-    RenderRoundedRect(shadow, 3, 0, 0, 0, 80); // Shadow
-    RenderRoundedRect(segment_rect, 3, r, g, b, 255); // Main body
-    
-    // Add highlight
-    SDL_Rect highlight = {segment_rect.x + 2, segment_rect.y + 2, segment_rect.w - 4, segment_rect.h / 3};
-    RenderRoundedRect(highlight, 2, std::min(255, r + 50), std::min(255, g + 30), std::min(255, b + 50), 100);
+  block.w = cell_width;
+  block.h = cell_height;
+  
+  // Render snake body with gradient and rounded segments, tail to head.
+  // Normally this is a single copy of the incrementally updated layer;
+  // under the scrolling camera only the visible cells are drawn.
+  if (scrolling_camera) {
+    RenderVisibleSnake(snapshot);
+  } else if (!RenderSnakeLayer(snapshot)) {
+    SnakeLayer::SplitRuns(snapshot.body, snapshot.body_end_seq, snake_layer_runs);
+    for (SnakeLayer::Run const &run : snake_layer_runs) {
+      RenderSnakeRun(run.first, run.last, SnakeLayer::BandRatio(run.band));
+    }
   }
   
-  // Render snake head with special effects
+  // Render snake head with special effects, slid between its previous and
+  // current cell so it moves smoothly at any frame rate
+  float head_x;
+  float head_y;
+  snapshot.InterpolatedHead(interpolation_alpha, head_x, head_y);
   SDL_Rect head_rect;
-  head_rect.x = static_cast<int>(snake.head_x) * block.w + 1;
-  head_rect.y = static_cast<int>(snake.head_y) * block.h + 1;
+  head_rect.x = static_cast<int>(std::lround(head_x * block.w)) - camera.x + 1;
+  head_rect.y = static_cast<int>(std::lround(head_y * block.h)) - camera.y + 1;
   head_rect.w = block.w - 2;
   head_rect.h = block.h - 2;
   
-  if (snake.alive) {
+  if (snapshot.alive) {
     // Bright cyan-blue head with glow
     SDL_Rect glow = {head_rect.x - 2, head_rect.y - 2, head_rect.w + 4, head_rect.h + 4};
     RenderRoundedRect(glow, 5, 0, 122, 204, 100); // Glow
@@ -259,27 +468,268 @@ void Renderer::RenderEnhancedSnake(Snake const snake) {
   }
 }
 
-void Renderer::DrawCircle(int center_x, int center_y, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, r, g, b, a);
-  
-  // Draw filled circle using Bresenham-like algorithm
-  for (int y = -radius; y <= radius; ++y) {
-    for (int x = -radius; x <= radius; ++x) {
-      if (x * x + y * y <= radius * radius) {
-        SDL_RenderDrawPoint(sdl_renderer, center_x + x, center_y + y);
+bool Renderer::RenderSnakeLayer(RenderSnapshot const &snapshot) {
+  int width = static_cast<int>(screen_width);
+  int height = static_cast<int>(screen_height);
+  SDL_GetRendererOutputSize(sdl_renderer, &width, &height);
+  if (!EnsureSnakeLayerTexture(width, height)) {
+    return false;
+  }
+
+  bool const clear_all = snake_layer.Sync(snapshot.body, snapshot.body_end_seq,
+                                          snake_layer_erase, snake_layer_runs);
+  if (clear_all || !snake_layer_erase.empty() || !snake_layer_runs.empty()) {
+    // Queued screen draws must land before the target switches.
+    batch.Flush();
+    if (SDL_SetRenderTarget(sdl_renderer, snake_layer_texture) != 0) {
+      snake_layer.Invalidate();
+      return false;
+    }
+    if (clear_all) {
+      SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 0);
+      SDL_RenderClear(sdl_renderer);
+    }
+
+    // A run, its shadow and its highlight all stay inside the run's cells,
+    // so clearing the cells erases it completely. Every erase happens
+    // before any paint, so a cell that is both vacated and repainted in the
+    // same frame ends up painted.
+    int const block_w = cell_width;
+    int const block_h = cell_height;
+    for (Point const &cell : snake_layer_erase) {
+      SDL_Rect const rect = {cell.x * block_w, cell.y * block_h, block_w, block_h};
+      batch.FillRect(rect, SDL_Color{0, 0, 0, 0}, SDL_BLENDMODE_NONE);
+    }
+    for (SnakeLayer::Run const &run : snake_layer_runs) {
+      int const x = std::min(run.first.x, run.last.x);
+      int const y = std::min(run.first.y, run.last.y);
+      SDL_Rect const rect = {x * block_w, y * block_h,
+                             (std::abs(run.last.x - run.first.x) + 1) * block_w,
+                             (std::abs(run.last.y - run.first.y) + 1) * block_h};
+      batch.FillRect(rect, SDL_Color{0, 0, 0, 0}, SDL_BLENDMODE_NONE);
+    }
+    for (SnakeLayer::Run const &run : snake_layer_runs) {
+      RenderSnakeRun(run.first, run.last, SnakeLayer::BandRatio(run.band));
+    }
+
+    batch.Flush();
+    SDL_SetRenderTarget(sdl_renderer, nullptr);
+  }
+
+  SDL_Rect const screen = {0, 0, width, height};
+  batch.Copy(snake_layer_texture, width, height, nullptr, screen);
+  return true;
+}
+
+bool Renderer::EnsureSnakeLayerTexture(int width, int height) {
+  if (snake_layer_unsupported) {
+    return false;
+  }
+  if (snake_layer_texture != nullptr && width == snake_layer_width &&
+      height == snake_layer_height) {
+    return true;
+  }
+  if (snake_layer_texture != nullptr) {
+    SDL_DestroyTexture(snake_layer_texture);
+    snake_layer_texture = nullptr;
+  }
+  if (!SDL_RenderTargetSupported(sdl_renderer) || width <= 0 || height <= 0) {
+    snake_layer_unsupported = true;
+    return false;
+  }
+
+  snake_layer_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                          SDL_TEXTUREACCESS_TARGET, width, height);
+  if (snake_layer_texture == nullptr) {
+    std::cerr << "Snake layer texture could not be created.\n";
+    std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+    snake_layer_unsupported = true;
+    return false;
+  }
+
+  SetPremultipliedBlend(snake_layer_texture);
+  snake_layer_width = width;
+  snake_layer_height = height;
+  snake_layer.Invalidate();
+  return true;
+}
+
+void Renderer::RenderVisibleSnake(RenderSnapshot const &snapshot) {
+  bool const clear_all = snake_layer.Sync(snapshot.body, snapshot.body_end_seq,
+                                          snake_layer_erase, snake_layer_runs);
+  snake_map.Apply(clear_all, snake_layer_erase, snake_layer_runs);
+
+  // Walk the cells under the camera rather than the body, so the cost
+  // follows the window size however long the snake is. Each run is drawn
+  // from its first visible cell; a run that carries on past the view is
+  // stretched one cell beyond it so its clipped end stays square.
+  int const first_x = camera.x / cell_width;
+  int const first_y = camera.y / cell_height;
+  int const end_x = std::min(static_cast<int>(grid_width),
+                             (camera.x + camera.w + cell_width - 1) / cell_width);
+  int const end_y = std::min(static_cast<int>(grid_height),
+                             (camera.y + camera.h + cell_height - 1) / cell_height);
+  for (int y = first_y; y < end_y; ++y) {
+    for (int x = first_x; x < end_x; ++x) {
+      int const band = snake_map.BandAt(x, y);
+      if (band < 0) {
+        continue;
       }
+      bool const from_left = x > 0 && snake_map.JoinsRight(x - 1, y);
+      bool const from_above = y > 0 && snake_map.JoinsDown(x, y - 1);
+      if ((from_left && x > first_x) || (from_above && y > first_y)) {
+        continue;  // Drawn with the cells before it
+      }
+      Point first{x, y};
+      Point last{x, y};
+      if (from_left || snake_map.JoinsRight(x, y)) {
+        first.x -= from_left ? 1 : 0;
+        while (last.x < end_x && snake_map.JoinsRight(last.x, y)) {
+          ++last.x;
+        }
+      } else if (from_above || snake_map.JoinsDown(x, y)) {
+        first.y -= from_above ? 1 : 0;
+        while (last.y < end_y && snake_map.JoinsDown(x, last.y)) {
+          ++last.y;
+        }
+      }
+      RenderSnakeRun(first, last, SnakeLayer::BandRatio(band));
     }
   }
-  
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
+}
+
+void Renderer::RenderMinimap(RenderSnapshot const &snapshot) {
+  if (!scrolling_camera) {
+    return;
+  }
+  UpdateMinimapTexture();
+
+  // One texel per summary tile, scaled so the longer side is
+  // kMinimapPixels, in the bottom-right corner
+  int const tiles_w = snake_map.SummaryWidth();
+  int const tiles_h = snake_map.SummaryHeight();
+  int const longest = std::max(tiles_w, tiles_h);
+  int const map_w = std::max(1, tiles_w * kMinimapPixels / longest);
+  int const map_h = std::max(1, tiles_h * kMinimapPixels / longest);
+  int const map_x = camera.w - map_w - kMinimapMargin;
+  int const map_y = camera.h - map_h - kMinimapMargin;
+  SDL_Rect const panel = {map_x - 2, map_y - 2, map_w + 4, map_h + 4};
+  batch.FillRect(panel, SDL_Color{0, 0, 0, 150});
+  if (minimap_texture != nullptr) {
+    SDL_Rect const map = {map_x, map_y, map_w, map_h};
+    batch.Copy(minimap_texture, tiles_w, tiles_h, nullptr, map);
+  }
+
+  float const scale_x = static_cast<float>(map_w) / grid_width;
+  float const scale_y = static_cast<float>(map_h) / grid_height;
+
+  // Camera outline
+  int const view_x = map_x + static_cast<int>(camera.x / cell_width * scale_x);
+  int const view_y = map_y + static_cast<int>(camera.y / cell_height * scale_y);
+  int const view_w = std::max(2, static_cast<int>(camera.w / cell_width * scale_x));
+  int const view_h = std::max(2, static_cast<int>(camera.h / cell_height * scale_y));
+  SDL_Color const outline{255, 255, 255, 200};
+  batch.FillRect(SDL_Rect{view_x, view_y, view_w, 1}, outline);
+  batch.FillRect(SDL_Rect{view_x, view_y + view_h - 1, view_w, 1}, outline);
+  batch.FillRect(SDL_Rect{view_x, view_y, 1, view_h}, outline);
+  batch.FillRect(SDL_Rect{view_x + view_w - 1, view_y, 1, view_h}, outline);
+
+  // Food and head markers
+  SDL_Rect const food = {map_x + static_cast<int>(snapshot.food.x * scale_x) - 1,
+                         map_y + static_cast<int>(snapshot.food.y * scale_y) - 1, 3, 3};
+  batch.FillRect(food, SDL_Color{255, 215, 0, 255});
+  SDL_Rect const head = {map_x + static_cast<int>(snapshot.head_x * scale_x) - 1,
+                         map_y + static_cast<int>(snapshot.head_y * scale_y) - 1, 3, 3};
+  batch.FillRect(head, SDL_Color{0, 150, 255, 255});
+}
+
+void Renderer::UpdateMinimapTexture() {
+  if (minimap_unavailable ||
+      (minimap_valid && minimap_version == snake_map.SummaryVersion())) {
+    return;
+  }
+  int const tiles_w = snake_map.SummaryWidth();
+  int const tiles_h = snake_map.SummaryHeight();
+  if (minimap_texture == nullptr) {
+    minimap_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                        SDL_TEXTUREACCESS_STREAMING, tiles_w, tiles_h);
+    if (minimap_texture == nullptr) {
+      std::cerr << "Minimap texture could not be created.\n";
+      std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+      minimap_unavailable = true;
+      return;
+    }
+    SDL_SetTextureBlendMode(minimap_texture, SDL_BLENDMODE_BLEND);
+  }
+
+  // Empty tiles are transparent; any snake at all shows, brighter the
+  // more of the tile it fills
+  float const tile_cells = static_cast<float>(snake_map.TileSize() * snake_map.TileSize());
+  minimap_pixels.resize(static_cast<std::size_t>(tiles_w) * tiles_h);
+  for (int ty = 0; ty < tiles_h; ++ty) {
+    for (int tx = 0; tx < tiles_w; ++tx) {
+      std::uint32_t const count = snake_map.TileCount(tx, ty);
+      Uint32 pixel = 0;
+      if (count > 0) {
+        float const fill = std::min(1.0f, count / tile_cells);
+        Uint32 const g = static_cast<Uint32>(120 + fill * 135);  // 120-255
+        pixel = 0xFF000000u | (50u << 16) | (g << 8) | 50u;
+      }
+      minimap_pixels[static_cast<std::size_t>(ty) * tiles_w + tx] = pixel;
+    }
+  }
+  SDL_UpdateTexture(minimap_texture, nullptr, minimap_pixels.data(),
+                    tiles_w * static_cast<int>(sizeof(Uint32)));
+  minimap_version = snake_map.SummaryVersion();
+  minimap_valid = true;
+}
+
+void Renderer::RenderSnakeRun(Point const &first, Point const &last, float ratio) {
+  SDL_Rect block;
+  block.w = cell_width;
+  block.h = cell_height;
+  int const cells_x = std::abs(last.x - first.x) + 1;
+  int const cells_y = std::abs(last.y - first.y) + 1;
+
+  // Green gradient for body
+  Uint8 r = static_cast<Uint8>(30 + ratio * 40);   // 30-70
+  Uint8 g = static_cast<Uint8>(120 + ratio * 135);  // 120-255
+  Uint8 b = static_cast<Uint8>(30 + ratio * 40);   // 30-70
+  
+  SDL_Rect segment_rect;
+  segment_rect.x = std::min(first.x, last.x) * block.w - camera.x + 2;
+  segment_rect.y = std::min(first.y, last.y) * block.h - camera.y + 2;
+  segment_rect.w = cells_x * block.w - 4;
+  segment_rect.h = cells_y * block.h - 4;
+  
+  // Draw rounded rectangle with shadow, stretched over the whole run
+  SDL_Rect shadow = {segment_rect.x + 2, segment_rect.y + 2, segment_rect.w, segment_rect.h};
+  RenderRoundedBar(shadow, 3, 0, 0, 0, 80); // Shadow
+  RenderRoundedBar(segment_rect, 3, r, g, b, 255); // Main body
+  
+  // Add highlight along the top edge, or the left edge of a vertical run
+  SDL_Rect highlight = {segment_rect.x + 2, segment_rect.y + 2, segment_rect.w - 4, (block.h - 4) / 3};
+  if (cells_y > 1) {
+    highlight.w = (block.w - 4) / 3;
+    highlight.h = segment_rect.h - 4;
+  }
+  RenderRoundedBar(highlight, 2, std::min(255, r + 50), std::min(255, g + 30), std::min(255, b + 50), 100);
+}
+
+void Renderer::DrawCircle(int center_x, int center_y, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+  // One tinted copy of the pre-rasterized, anti-aliased disc
+  if (sprite_atlas.DrawCircle(batch, center_x, center_y, radius, SDL_Color{r, g, b, a})) {
+    return;
+  }
+
+  // Atlas unavailable: fall back to a plain square of the same extent
+  SDL_Rect bounds = {center_x - radius, center_y - radius, 2 * radius + 1, 2 * radius + 1};
+  batch.FillRect(bounds, SDL_Color{r, g, b, a});
 }
 
 void Renderer::SetPixel(int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, r, g, b, a);
-  SDL_RenderDrawPoint(sdl_renderer, x, y);
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
+  SDL_Rect const pixel = {x, y, 1, 1};
+  batch.FillRect(pixel, SDL_Color{r, g, b, a});
 }
 
 void Renderer::RenderScoreCard(int score) {
@@ -293,101 +743,149 @@ void Renderer::RenderScoreCard(int score) {
 }
 
 void Renderer::RenderStartScreen() {
-  // Semi-transparent overlay
-  SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 100);
-  SDL_RenderFillRect(sdl_renderer, &overlay);
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
-  
-  // Start screen panel
-  int panel_width = 350;
-  int panel_height = 250;
-  int panel_x = (screen_width - panel_width) / 2;
-  int panel_y = (screen_height - panel_height) / 2;
-  
-  SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
-  RenderRoundedRect(panel, 15, 40, 60, 40, 220); // Dark green theme
-  
-  // Border glow
-  SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
-  RenderRoundedRect(border, 17, 100, 255, 100, 150); // Green glow
-  RenderRoundedRect(panel, 15, 40, 60, 40, 220); // Dark green (redraw over glow)
-  
-  // Title
-  RenderBitmapText("SNAKEGAME-C", panel_x + 80, panel_y + 30, 3);
-  
-  // Instructions
-  RenderBitmapText("CONTROLS:", panel_x + 30, panel_y + 80, 2);
-  RenderBitmapText("ARROW KEYS - MOVE", panel_x + 30, panel_y + 110, 2);
-  RenderBitmapText("SPACEBAR - PAUSE/RESUME", panel_x + 30, panel_y + 140, 2);
-  RenderBitmapText("R - RETRY WHEN GAME OVER", panel_x + 30, panel_y + 170, 2);
-  
-  // Start instruction
-  RenderBitmapText("PRESS ANY KEY TO START", panel_x + 40, panel_y + 210, 2);
+  RenderCachedOverlay(start_overlay, 0, [this] {
+    // Semi-transparent overlay
+    SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
+    batch.FillRect(overlay, SDL_Color{0, 0, 0, 100});
+    
+    // Start screen panel
+    int panel_width = 350;
+    int panel_height = 250;
+    int panel_x = (screen_width - panel_width) / 2;
+    int panel_y = (screen_height - panel_height) / 2;
+    
+    // Border glow, then the panel over it
+    SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
+    RenderRoundedRect(border, 17, 100, 255, 100, 150); // Green glow
+    SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
+    RenderRoundedRect(panel, 15, 40, 60, 40, 220); // Dark green theme
+    
+    // Title
+    RenderBitmapText("SNAKEGAME-C", panel_x + 80, panel_y + 30, 3);
+    
+    // Instructions
+    RenderBitmapText("CONTROLS:", panel_x + 30, panel_y + 80, 2);
+    RenderBitmapText("ARROW KEYS - MOVE", panel_x + 30, panel_y + 110, 2);
+    RenderBitmapText("SPACEBAR - PAUSE/RESUME", panel_x + 30, panel_y + 140, 2);
+    RenderBitmapText("R - RETRY WHEN GAME OVER", panel_x + 30, panel_y + 170, 2);
+    
+    // Start instruction
+    RenderBitmapText("PRESS ANY KEY TO START", panel_x + 40, panel_y + 210, 2);
+  });
 }
 
 void Renderer::RenderPauseOverlay() {
-  // Semi-transparent dark overlay
-  SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 120);
-  SDL_RenderFillRect(sdl_renderer, &overlay);
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
-  
-  // Pause panel
-  int panel_width = 250;
-  int panel_height = 120;
-  int panel_x = (screen_width - panel_width) / 2;
-  int panel_y = (screen_height - panel_height) / 2;
-  
-  SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
-  RenderRoundedRect(panel, 15, 60, 60, 60, 240); // Dark gray
-  
-  // Border glow
-  SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
-  RenderRoundedRect(border, 17, 100, 150, 255, 180); // Blue glow
-  RenderRoundedRect(panel, 15, 60, 60, 60, 240); // Dark gray (redraw over glow)
-  
-  // Pause text
-  RenderBitmapText("PAUSED", panel_x + 85, panel_y + 30, 3);
-  
-  // Resume instruction
-  RenderBitmapText("PRESS SPACE TO RESUME", panel_x + 15, panel_y + 75, 2);
+  RenderCachedOverlay(pause_overlay, 0, [this] {
+    // Semi-transparent dark overlay
+    SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
+    batch.FillRect(overlay, SDL_Color{0, 0, 0, 120});
+    
+    // Pause panel
+    int panel_width = 250;
+    int panel_height = 120;
+    int panel_x = (screen_width - panel_width) / 2;
+    int panel_y = (screen_height - panel_height) / 2;
+    
+    // Border glow, then the panel over it
+    SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
+    RenderRoundedRect(border, 17, 100, 150, 255, 180); // Blue glow
+    SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
+    RenderRoundedRect(panel, 15, 60, 60, 60, 240); // Dark gray
+    
+    // Pause text
+    RenderBitmapText("PAUSED", panel_x + 85, panel_y + 30, 3);
+    
+    // Resume instruction
+    RenderBitmapText("PRESS SPACE TO RESUME", panel_x + 15, panel_y + 75, 2);
+  });
 }
 
-void Renderer::RenderGameOverScreen(int score) {
-  // Semi-transparent overlay
-  SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-  SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 150);
-  SDL_RenderFillRect(sdl_renderer, &overlay);
-  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_NONE);
-  
-  // Game over panel
-  int panel_width = 300;
-  int panel_height = 200;
-  int panel_x = (screen_width - panel_width) / 2;
-  int panel_y = (screen_height - panel_height) / 2;
-  
-  SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
-  RenderRoundedRect(panel, 15, 40, 40, 40, 240); // Dark gray
-  
-  // Border glow
-  SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
-  RenderRoundedRect(border, 17, 255, 100, 100, 180); // Red glow
-  RenderRoundedRect(panel, 15, 40, 40, 40, 240); // Dark gray (redraw over glow)
-  
-  // Title
-  RenderBitmapText("GAME OVER", panel_x + 70, panel_y + 30, 3);
-  
-  // Final score
-  std::string final_score = "FINAL SCORE: " + std::to_string(score);
-  RenderBitmapText(final_score, panel_x + 50, panel_y + 80, 2);
-  
-  // Instructions
-  RenderBitmapText("PRESS R TO RETRY", panel_x + 40, panel_y + 120, 2);
-  RenderBitmapText("PRESS ESC TO QUIT", panel_x + 35, panel_y + 150, 2);
+void Renderer::RenderGameOverScreen(int score, bool won) {
+  std::int64_t const key = static_cast<std::int64_t>(score) * 2 + (won ? 1 : 0);
+  RenderCachedOverlay(game_over_overlay, key, [this, score, won] {
+    // Semi-transparent overlay
+    SDL_Rect overlay = {0, 0, static_cast<int>(screen_width), static_cast<int>(screen_height)};
+    batch.FillRect(overlay, SDL_Color{0, 0, 0, 150});
+    
+    // Game over panel
+    int panel_width = 300;
+    int panel_height = 200;
+    int panel_x = (screen_width - panel_width) / 2;
+    int panel_y = (screen_height - panel_height) / 2;
+    
+    // Border glow, then the panel over it
+    SDL_Rect border = {panel_x - 2, panel_y - 2, panel_width + 4, panel_height + 4};
+    if (won) {
+      RenderRoundedRect(border, 17, 100, 255, 100, 180); // Green glow
+    } else {
+      RenderRoundedRect(border, 17, 255, 100, 100, 180); // Red glow
+    }
+    SDL_Rect panel = {panel_x, panel_y, panel_width, panel_height};
+    RenderRoundedRect(panel, 15, 40, 40, 40, 240); // Dark gray
+    
+    // Title
+    if (won) {
+      RenderBitmapText("YOU WIN", panel_x + 88, panel_y + 30, 3);
+    } else {
+      RenderBitmapText("GAME OVER", panel_x + 70, panel_y + 30, 3);
+    }
+    
+    // Final score
+    std::string final_score = "FINAL SCORE: " + std::to_string(score);
+    RenderBitmapText(final_score, panel_x + 50, panel_y + 80, 2);
+    
+    // Instructions
+    RenderBitmapText("PRESS R TO RETRY", panel_x + 40, panel_y + 120, 2);
+    RenderBitmapText("PRESS ESC TO QUIT", panel_x + 35, panel_y + 150, 2);
+  });
+}
+
+void Renderer::RenderCachedOverlay(CachedOverlay &overlay, std::int64_t key,
+                                   std::function<void()> const &draw) {
+  int const width = static_cast<int>(screen_width);
+  int const height = static_cast<int>(screen_height);
+  SDL_Rect const screen = {0, 0, width, height};
+  if (overlay.valid && overlay.key == key) {
+    batch.Copy(overlay.texture, width, height, nullptr, screen);
+    return;
+  }
+
+  if (overlay.texture == nullptr && !overlay.unavailable) {
+    if (SDL_RenderTargetSupported(sdl_renderer)) {
+      overlay.texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                          SDL_TEXTUREACCESS_TARGET, width, height);
+    }
+    if (overlay.texture == nullptr) {
+      overlay.unavailable = true;
+    } else {
+      SetPremultipliedBlend(overlay.texture);
+    }
+  }
+
+  // Queued screen draws must land before the target switches.
+  batch.Flush();
+  if (overlay.unavailable ||
+      SDL_SetRenderTarget(sdl_renderer, overlay.texture) != 0) {
+    draw();  // Straight onto the screen, as before caching
+    return;
+  }
+  SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 0);
+  SDL_RenderClear(sdl_renderer);
+  draw();
+  batch.Flush();
+  SDL_SetRenderTarget(sdl_renderer, nullptr);
+  overlay.key = key;
+  overlay.valid = true;
+
+  batch.Copy(overlay.texture, width, height, nullptr, screen);
+}
+
+void Renderer::ReleaseOverlay(CachedOverlay &overlay) {
+  if (overlay.texture != nullptr) {
+    SDL_DestroyTexture(overlay.texture);
+    overlay.texture = nullptr;
+  }
+  overlay.valid = false;
 }
 
 void Renderer::RenderText(const std::string& text, int x, int y, int size, Uint8 r, Uint8 g, Uint8 b) {
@@ -396,66 +894,6 @@ void Renderer::RenderText(const std::string& text, int x, int y, int size, Uint8
 }
 
 void Renderer::RenderBitmapText(const std::string& text, int x, int y, int scale) {
-  // Simple bitmap font - 5x7 pixel characters
-  // This is a simplified version for demonstration
-  static const std::map<char, std::vector<std::vector<int>>> font = {
-    {'A', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,1,1,1,1},{1,0,0,0,1},{1,0,0,0,1},{0,0,0,0,0}}},
-    {'B', {{1,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,1,1,1,0},{1,0,0,0,1},{1,1,1,1,0},{0,0,0,0,0}}},
-    {'C', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,0},{1,0,0,0,0},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'E', {{1,1,1,1,1},{1,0,0,0,0},{1,0,0,0,0},{1,1,1,1,0},{1,0,0,0,0},{1,1,1,1,1},{0,0,0,0,0}}},
-    {'F', {{1,1,1,1,1},{1,0,0,0,0},{1,0,0,0,0},{1,1,1,1,0},{1,0,0,0,0},{1,0,0,0,0},{0,0,0,0,0}}},
-    {'G', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,0},{1,0,1,1,1},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'M', {{1,0,0,0,1},{1,1,0,1,1},{1,0,1,0,1},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{0,0,0,0,0}}},
-    {'O', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'R', {{1,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,1,1,1,0},{1,0,0,1,0},{1,0,0,0,1},{0,0,0,0,0}}},
-    {'S', {{0,1,1,1,1},{1,0,0,0,0},{0,1,1,1,0},{0,0,0,0,1},{0,0,0,0,1},{1,1,1,1,0},{0,0,0,0,0}}},
-    {'T', {{1,1,1,1,1},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,0,0,0}}},
-    {'V', {{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{0,1,0,1,0},{0,0,1,0,0},{0,0,0,0,0}}},
-    {'Y', {{1,0,0,0,1},{1,0,0,0,1},{0,1,0,1,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,0,0,0}}},
-    {' ', {{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0}}},
-    {':', {{0,0,0,0,0},{0,0,1,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,1,0,0},{0,0,0,0,0},{0,0,0,0,0}}},
-    {'0', {{0,1,1,1,0},{1,0,0,1,1},{1,0,1,0,1},{1,1,0,0,1},{1,1,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'1', {{0,0,1,0,0},{0,1,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{1,1,1,1,1},{0,0,0,0,0}}},
-    {'2', {{0,1,1,1,0},{1,0,0,0,1},{0,0,0,1,0},{0,0,1,0,0},{0,1,0,0,0},{1,1,1,1,1},{0,0,0,0,0}}},
-    {'3', {{1,1,1,1,0},{0,0,0,0,1},{0,1,1,1,0},{0,0,0,0,1},{0,0,0,0,1},{1,1,1,1,0},{0,0,0,0,0}}},
-    {'4', {{1,0,0,1,0},{1,0,0,1,0},{1,0,0,1,0},{1,1,1,1,1},{0,0,0,1,0},{0,0,0,1,0},{0,0,0,0,0}}},
-    {'5', {{1,1,1,1,1},{1,0,0,0,0},{1,1,1,1,0},{0,0,0,0,1},{0,0,0,0,1},{1,1,1,1,0},{0,0,0,0,0}}},
-    {'6', {{0,1,1,1,0},{1,0,0,0,0},{1,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'7', {{1,1,1,1,1},{0,0,0,0,1},{0,0,0,1,0},{0,0,1,0,0},{0,1,0,0,0},{0,1,0,0,0},{0,0,0,0,0}}},
-    {'8', {{0,1,1,1,0},{1,0,0,0,1},{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'9', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{0,1,1,1,1},{0,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'L', {{1,0,0,0,0},{1,0,0,0,0},{1,0,0,0,0},{1,0,0,0,0},{1,0,0,0,0},{1,1,1,1,1},{0,0,0,0,0}}},
-    {'N', {{1,0,0,0,1},{1,1,0,0,1},{1,0,1,0,1},{1,0,0,1,1},{1,0,0,0,1},{1,0,0,0,1},{0,0,0,0,0}}},
-    {'I', {{1,1,1,1,1},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{0,0,1,0,0},{1,1,1,1,1},{0,0,0,0,0}}},
-    {'P', {{1,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,1,1,1,0},{1,0,0,0,0},{1,0,0,0,0},{0,0,0,0,0}}},
-    {'U', {{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{1,0,0,0,1},{0,1,1,1,0},{0,0,0,0,0}}},
-    {'Q', {{0,1,1,1,0},{1,0,0,0,1},{1,0,0,0,1},{1,0,1,0,1},{1,0,0,1,1},{0,1,1,1,1},{0,0,0,0,0}}}
-  };
-  
-  SDL_SetRenderDrawColor(sdl_renderer, 255, 255, 255, 255); // White text
-  
-  int char_width = 6 * scale; // 5 pixels + 1 spacing
-  int char_x = x;
-  
-  for (char c : text) {
-    char upper_c = std::toupper(c);
-    auto it = font.find(upper_c);
-    if (it != font.end()) {
-      const auto& char_data = it->second;
-      for (int row = 0; row < 7; ++row) {
-        for (int col = 0; col < 5; ++col) {
-          if (char_data[row][col]) {
-            SDL_Rect pixel = {
-              char_x + col * scale,
-              y + row * scale,
-              scale,
-              scale
-            };
-            SDL_RenderFillRect(sdl_renderer, &pixel);
-          }
-        }
-      }
-    }
-    char_x += char_width;
-  }
+  // Simple bitmap font - 5x7 pixel characters, drawn from a cached run
+  bitmap_font.DrawCachedText(batch, text, x, y, scale);
 }
@@ -16,10 +16,12 @@
  * Advanced Features:
  * - Gradient background rendering with nature-inspired themes
  * - Real-time particle system with physics simulation
- * - Rounded rectangle rendering with smooth edges
- * - Custom bitmap font system for crisp text rendering
- * - Multi-state UI rendering (Start, Game, Pause, GameOver)
+ * - Anti-aliased circles and rounded rectangles from a sprite atlas
+ * - Custom bitmap font with a glyph atlas and cached text runs
+ * - Multi-state UI rendering (Start, Game, Pause, GameOver, Won)
  * - Alpha blending and transparency effects
+ * - Batched geometry submission, one draw per render state
+ * - Scrolling camera and minimap for boards larger than the window
  * 
  * Copyright (c) 2025 Your Name. All rights reserved.
  * ============================================================================
@@ -30,30 +32,61 @@
 
 #include <vector>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include "SDL.h"
-#include "snake.h"
+#include "game_state.h"
+#include "point.h"
+#include "render_snapshot.h"
 #include "particle.h"
-
-enum class GameState {
-  StartScreen,
-  Playing,
-  Paused,
-  GameOver
-};
+#include "work_stealing_pool.h"
+#include "render_batch.h"
+#include "bitmap_font.h"
+#include "sprite_atlas.h"
+#include "snake_layer.h"
+#include "snake_map.h"
+#include "frame_stats.h"
 
 class Renderer {
  public:
+  // Vertical background gradient, top row to bottom row.
+  struct BackgroundTheme {
+    SDL_Color top{10, 20, 15, 255};
+    SDL_Color bottom{40, 80, 40, 255};
+  };
+
   Renderer(const std::size_t screen_width, const std::size_t screen_height,
            const std::size_t grid_width, const std::size_t grid_height);
   ~Renderer();
 
-  void Render(Snake const snake, SDL_Point const &food, int score, GameState game_state);
+  // `alpha` is how far real time has advanced into the next simulation tick
+  // (0-1); `frame_seconds` is the wall-clock time since the previous frame.
+  void Render(RenderSnapshot const &snapshot, float alpha, float frame_seconds);
+  // Submits the batched frame and flips it to the screen (may block on
+  // vsync).
+  void Present();
+  // Draws the F3 performance overlay: per-phase percentiles and a graph of
+  // recent frame times. Call between Render() and Present().
+  void RenderPerfOverlay(FrameStats const &stats);
   void UpdateWindowTitle(int score, int fps);
+  // Takes effect on the next frame; the cached background is rebuilt.
+  void SetBackgroundTheme(BackgroundTheme const &theme);
   void EmitFoodParticles(float x, float y);
+  void EmitDeathParticles(float x, float y);
   void UpdateParticles(float dt);
+  // Fireworks stress mode: food and death emit tens of thousands of
+  // particles, and the pool grows to hold about a million.
+  void SetFireworksMode(bool enabled);
+  bool FireworksMode() const { return fireworks_mode; }
+  // Call when SDL reports that render target contents were lost; the snake
+  // layer and the cached overlays are redrawn on the next frame.
+  void InvalidateRenderTargets();
 
  private:
+  // Lets snake_bench time the private draw helpers.
+  friend struct RendererBenchAccess;
+
   SDL_Window *sdl_window;
   SDL_Renderer *sdl_renderer;
 
@@ -61,16 +94,97 @@ class Renderer {
   const std::size_t screen_height;
   const std::size_t grid_width;
   const std::size_t grid_height;
+
+  // Size of one board cell on screen. A board that fits the window at
+  // kCameraCellPixels or more per cell is stretched across it; a larger
+  // one is drawn at kCameraCellPixels through a camera that follows the
+  // head, and everything on the board is culled to the camera's view.
+  static constexpr int kCameraCellPixels{20};
+  int cell_width;
+  int cell_height;
+  bool scrolling_camera;
+  // Visible part of the board in board pixels; x and y stay 0 when the
+  // whole board fits.
+  SDL_Rect camera{0, 0, 0, 0};
   
   // Enhanced graphics features
   ParticleSystem particle_system;
+  WorkStealingPool particle_workers;
+  bool fireworks_mode{false};
   float animation_time;
+  float interpolation_alpha;
+
+  // Every draw of the frame is queued here and submitted at Present().
+  RenderBatch batch;
+  std::size_t last_frame_draw_calls{0};
+
+  // 5x7 glyph atlas and cached text runs.
+  BitmapFont bitmap_font;
+
+  // Pre-rasterized circles and rounded rects, drawn as tinted copies.
+  SpriteAtlas sprite_atlas;
+
+  // Background gradient baked into a one-pixel-wide texture that is
+  // stretched across the screen. Rebuilt when the output size or theme
+  // changes.
+  BackgroundTheme background_theme;
+  SDL_Texture *background_texture{nullptr};
+  int background_width{0};
+  int background_height{0};
+
+  // Snake body drawn into a persistent screen-sized target texture as
+  // straight runs. Each frame only the runs that changed since the last one
+  // are erased and repainted (see SnakeLayer); the whole layer is then
+  // composited with a single copy. Falls back to drawing every run if
+  // render targets are unavailable.
+  SnakeLayer snake_layer;
+  SDL_Texture *snake_layer_texture{nullptr};
+  int snake_layer_width{0};
+  int snake_layer_height{0};
+  bool snake_layer_unsupported{false};
+  std::vector<Point> snake_layer_erase;
+  std::vector<SnakeLayer::Run> snake_layer_runs;
+
+  // With the scrolling camera the layer texture is not used. The same
+  // erase and paint lists update a board-sized map instead, from which the
+  // visible cells are drawn directly; its tile summary is the minimap,
+  // uploaded into a small streaming texture whenever it changes.
+  SnakeMap snake_map;
+  SDL_Texture *minimap_texture{nullptr};
+  std::uint64_t minimap_version{0};
+  bool minimap_valid{false};
+  bool minimap_unavailable{false};
+  std::vector<Uint32> minimap_pixels;
+
+  // A full-screen overlay (dim, panel and text) drawn once into a target
+  // texture and composited with a single copy until `key` (the values it
+  // shows) changes.
+  struct CachedOverlay {
+    SDL_Texture *texture{nullptr};
+    std::int64_t key{0};
+    bool valid{false};
+    bool unavailable{false};  // Drawn directly; no render target support
+  };
+  CachedOverlay start_overlay;
+  CachedOverlay pause_overlay;
+  CachedOverlay game_over_overlay;
   
   // Helper methods for advanced graphics
   void RenderGradientBackground();
+  void RebuildBackgroundTexture(int width, int height);
   void RenderRoundedRect(SDL_Rect rect, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
-  void RenderGlowingFood(SDL_Point const &food);
-  void RenderEnhancedSnake(Snake const snake);
+  void RenderRoundedBar(SDL_Rect rect, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
+  void UpdateCamera(RenderSnapshot const &snapshot);
+  void RenderGlowingFood(Point const &food);
+  void RenderEnhancedSnake(RenderSnapshot const &snapshot);
+  bool RenderSnakeLayer(RenderSnapshot const &snapshot);
+  void RenderVisibleSnake(RenderSnapshot const &snapshot);
+  void RenderMinimap(RenderSnapshot const &snapshot);
+  void UpdateMinimapTexture();
+  bool EnsureSnakeLayerTexture(int width, int height);
+  // Draws segments `first` to `last` (one row or column) as one stretched
+  // segment.
+  void RenderSnakeRun(Point const &first, Point const &last, float ratio);
   void DrawCircle(int center_x, int center_y, int radius, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
   void SetPixel(int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
   
@@ -78,7 +192,10 @@ class Renderer {
   void RenderScoreCard(int score);
   void RenderStartScreen();
   void RenderPauseOverlay();
-  void RenderGameOverScreen(int score);
+  void RenderGameOverScreen(int score, bool won = false);
+  void RenderCachedOverlay(CachedOverlay &overlay, std::int64_t key,
+                           std::function<void()> const &draw);
+  void ReleaseOverlay(CachedOverlay &overlay);
   void RenderText(const std::string& text, int x, int y, int size, Uint8 r, Uint8 g, Uint8 b);
   void RenderBitmapText(const std::string& text, int x, int y, int scale = 2);
 };
@@ -0,0 +1,735 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Deterministic Replay Implementation
+ * ============================================================================
+ *
+ * File: replay.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "replay.h"
+#include "board_limits.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'N', 'K', 'R', 'P', 'L', 'A', 'Y'};
+constexpr char kIndexMagic[8] = {'S', 'N', 'K', 'I', 'N', 'D', 'E', 'X'};
+constexpr std::size_t kIndexEntrySize{16};
+constexpr std::size_t kTrailerSize{32};
+
+// Pending bytes before the writer hands them to the OS (about a second of
+// play), which bounds what a crash can lose.
+constexpr std::size_t kFlushThreshold{4096};
+
+void PutLittleEndian(std::vector<unsigned char> &out, std::uint64_t value,
+                     int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+  }
+}
+
+std::uint64_t GetLittleEndian(unsigned char const *in, int bytes) {
+  std::uint64_t value = 0;
+  for (int i = 0; i < bytes; ++i) {
+    value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+void PutVarint(std::vector<unsigned char> &out, std::uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<unsigned char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(value));
+}
+
+// Decodes a varint from data[position, end). Returns false if it runs off
+// the end; `overlong` is set if it is longer than any 64-bit value.
+bool GetVarint(unsigned char const *data, std::size_t end,
+               std::size_t &position, std::uint64_t &value, bool &overlong) {
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (position >= end) {
+      return false;
+    }
+    unsigned char const byte = data[position++];
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  overlong = true;
+  return false;
+}
+
+std::uint64_t ZigZag(std::int64_t value) {
+  return (static_cast<std::uint64_t>(value) << 1) ^
+         static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t UnZigZag(std::uint64_t value) {
+  return static_cast<std::int64_t>(value >> 1) ^
+         -static_cast<std::int64_t>(value & 1);
+}
+
+void PutFloat(std::vector<unsigned char> &out, float value) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  PutLittleEndian(out, bits, 4);
+}
+
+// Bounds-checked cursor over an encoded keyframe.
+class ByteReader {
+ public:
+  ByteReader(unsigned char const *data, std::size_t size)
+      : data(data), size(size) {}
+
+  bool Varint(std::uint64_t &value) {
+    bool overlong = false;
+    return GetVarint(data, size, position, value, overlong);
+  }
+  // A varint below `limit`, stored into an integer or enum field.
+  template <typename T>
+  bool Below(std::uint64_t limit, T &field) {
+    std::uint64_t value;
+    if (!Varint(value) || value >= limit) {
+      return false;
+    }
+    field = static_cast<T>(value);
+    return true;
+  }
+  bool Fixed(std::uint64_t &value, int bytes) {
+    if (size - position < static_cast<std::size_t>(bytes)) {
+      return false;
+    }
+    value = GetLittleEndian(data + position, bytes);
+    position += static_cast<std::size_t>(bytes);
+    return true;
+  }
+  bool Float(float &value) {
+    std::uint64_t bits;
+    if (!Fixed(bits, 4)) {
+      return false;
+    }
+    std::uint32_t const narrow = static_cast<std::uint32_t>(bits);
+    std::memcpy(&value, &narrow, sizeof(value));
+    return true;
+  }
+  bool Bytes(unsigned char const *&out, std::size_t count) {
+    if (size - position < count) {
+      return false;
+    }
+    out = data + position;
+    position += count;
+    return true;
+  }
+  bool AtEnd() const { return position == size; }
+
+ private:
+  unsigned char const *data;
+  std::size_t size;
+  std::size_t position{0};
+};
+
+// Steps to neighbouring cells, in Snake::Direction order. Steps wrap
+// around the board edges like the snake does.
+constexpr int kStepX[4] = {0, 0, -1, 1};
+constexpr int kStepY[4] = {-1, 1, 0, 0};
+
+// Shortest signed distance from a to b on a ring of `extent` cells.
+int WrappedDelta(int a, int b, int extent) {
+  int delta = (b - a) % extent;
+  if (delta > extent / 2) {
+    delta -= extent;
+  } else if (delta < -(extent - 1) / 2) {
+    delta += extent;
+  }
+  return delta;
+}
+
+int Wrap(std::int64_t value, int extent) {
+  std::int64_t const wrapped = value % extent;
+  return static_cast<int>(wrapped < 0 ? wrapped + extent : wrapped);
+}
+
+void EncodeKeyframe(SimulationState const &state, int grid_width,
+                    int grid_height, std::vector<unsigned char> &out) {
+  out.clear();
+  PutVarint(out, static_cast<std::uint64_t>(state.game_state));
+  PutVarint(out, static_cast<std::uint64_t>(state.score));
+  PutVarint(out, static_cast<std::uint64_t>(state.food.x));
+  PutVarint(out, static_cast<std::uint64_t>(state.food.y));
+  PutLittleEndian(out, state.rng_state, 8);
+  PutLittleEndian(out, state.rng_increment, 8);
+  PutVarint(out, state.queued_turns.size());
+  for (Snake::Direction direction : state.queued_turns) {
+    PutVarint(out, static_cast<std::uint64_t>(direction));
+  }
+  PutVarint(out, state.last_turn_cell + 1);  // "None" (all ones) becomes 0
+
+  PutVarint(out, static_cast<std::uint64_t>(state.direction));
+  PutVarint(out, static_cast<std::uint64_t>(state.alive) |
+                     (static_cast<std::uint64_t>(state.growing) << 1));
+  PutVarint(out, static_cast<std::uint64_t>(state.size));
+  PutVarint(out, state.body_pushes);
+  PutFloat(out, state.speed);
+  PutFloat(out, state.head_x);
+  PutFloat(out, state.head_y);
+  PutFloat(out, state.prev_head_x);
+  PutFloat(out, state.prev_head_y);
+
+  std::vector<Point> const &body = state.body;
+  PutVarint(out, body.size());
+  if (body.empty()) {
+    return;
+  }
+  PutVarint(out, static_cast<std::uint64_t>(body[0].x));
+  PutVarint(out, static_cast<std::uint64_t>(body[0].y));
+
+  // Two bits per step. Past speed 1 the snake skips cells; those steps
+  // are listed after the packed ones.
+  std::size_t const steps = body.size() - 1;
+  std::size_t const packed_start = out.size();
+  out.resize(packed_start + (steps + 3) / 4, 0);
+  std::vector<std::size_t> jumps;
+  for (std::size_t i = 0; i < steps; ++i) {
+    int const dx = WrappedDelta(body[i].x, body[i + 1].x, grid_width);
+    int const dy = WrappedDelta(body[i].y, body[i + 1].y, grid_height);
+    int code = 0;
+    while (code < 4 && (dx != kStepX[code] || dy != kStepY[code])) {
+      ++code;
+    }
+    if (code == 4) {
+      jumps.push_back(i);
+      code = 0;
+    }
+    out[packed_start + i / 4] |=
+        static_cast<unsigned char>(code << (2 * (i % 4)));
+  }
+  PutVarint(out, jumps.size());
+  for (std::size_t i : jumps) {
+    PutVarint(out, i);
+    PutVarint(out, ZigZag(WrappedDelta(body[i].x, body[i + 1].x, grid_width)));
+    PutVarint(out, ZigZag(WrappedDelta(body[i].y, body[i + 1].y, grid_height)));
+  }
+}
+
+bool DecodeKeyframe(unsigned char const *data, std::size_t size,
+                    int grid_width, int grid_height, SimulationState &state) {
+  ByteReader in(data, size);
+  std::uint64_t const width = static_cast<std::uint64_t>(grid_width);
+  std::uint64_t const height = static_cast<std::uint64_t>(grid_height);
+  std::uint64_t const cells = width * height;
+
+  std::size_t turns;
+  if (!in.Below(static_cast<std::uint64_t>(GameState::Won) + 1,
+                state.game_state) ||
+      !in.Below(cells + 1, state.score) || !in.Below(width, state.food.x) ||
+      !in.Below(height, state.food.y) || !in.Fixed(state.rng_state, 8) ||
+      !in.Fixed(state.rng_increment, 8) ||
+      !in.Below(Simulation::kMaxQueuedTurns + 1, turns)) {
+    return false;
+  }
+  state.queued_turns.resize(turns);
+  for (Snake::Direction &direction : state.queued_turns) {
+    if (!in.Below(4, direction)) {
+      return false;
+    }
+  }
+  std::uint64_t last_turn_cell;
+  if (!in.Varint(last_turn_cell)) {
+    return false;
+  }
+  state.last_turn_cell = last_turn_cell - 1;
+
+  unsigned flags;
+  if (!in.Below(4, state.direction) || !in.Below(4, flags) ||
+      !in.Below(cells + 1, state.size) || !in.Varint(state.body_pushes) ||
+      !in.Float(state.speed) || !in.Float(state.head_x) ||
+      !in.Float(state.head_y) || !in.Float(state.prev_head_x) ||
+      !in.Float(state.prev_head_y)) {
+    return false;
+  }
+  state.alive = (flags & 1) != 0;
+  state.growing = (flags & 2) != 0;
+  if (!(state.head_x >= 0.0f && state.head_x < grid_width &&
+        state.head_y >= 0.0f && state.head_y < grid_height)) {
+    return false;
+  }
+
+  std::size_t count;
+  if (!in.Below(cells, count)) {
+    return false;
+  }
+  state.body.resize(count);
+  if (count == 0) {
+    return in.AtEnd();
+  }
+  std::size_t const steps = count - 1;
+  unsigned char const *packed;
+  std::size_t jump_count;
+  if (!in.Below(width, state.body[0].x) ||
+      !in.Below(height, state.body[0].y) ||
+      !in.Bytes(packed, (steps + 3) / 4) || !in.Below(count, jump_count)) {
+    return false;
+  }
+
+  // Walk the steps, taking each listed jump in place of its packed code
+  std::size_t jumps_read = 0;
+  std::size_t next_jump = steps;
+  std::uint64_t jump_x = 0;
+  std::uint64_t jump_y = 0;
+  auto read_jump = [&]() {
+    std::size_t const previous = next_jump;
+    next_jump = steps;
+    if (jumps_read == jump_count) {
+      return true;
+    }
+    ++jumps_read;
+    return in.Below(steps, next_jump) &&
+           (jumps_read == 1 || next_jump > previous) && in.Varint(jump_x) &&
+           in.Varint(jump_y);
+  };
+  if (!read_jump()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < steps; ++i) {
+    Point const from = state.body[i];
+    if (i == next_jump) {
+      state.body[i + 1] = {Wrap(from.x + UnZigZag(jump_x), grid_width),
+                           Wrap(from.y + UnZigZag(jump_y), grid_height)};
+      if (!read_jump()) {
+        return false;
+      }
+    } else {
+      int const code = (packed[i / 4] >> (2 * (i % 4))) & 3;
+      state.body[i + 1] = {Wrap(from.x + kStepX[code], grid_width),
+                           Wrap(from.y + kStepY[code], grid_height)};
+    }
+  }
+  return jumps_read == jump_count && in.AtEnd();
+}
+
+}  // namespace
+
+bool ReplayWriter::Open(std::string const &path, ReplayHeader const &header) {
+  Close();
+  file = std::fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  buffer.clear();
+  buffer.reserve(2 * kFlushThreshold);
+  for (char const c : kMagic) {
+    buffer.push_back(static_cast<unsigned char>(c));
+  }
+  PutLittleEndian(buffer, header.version, 4);
+  PutLittleEndian(buffer, header.grid_width, 4);
+  PutLittleEndian(buffer, header.grid_height, 4);
+  PutLittleEndian(buffer, header.ticks_per_second, 4);
+  PutLittleEndian(buffer, header.keyframe_interval, 4);
+  PutLittleEndian(buffer, 0, 4);  // Reserved
+  PutLittleEndian(buffer, header.seed, 8);
+  flushed_bytes = 0;
+  last_tick = 0;
+  ticks_recorded = 0;
+  keyframe_interval = std::max<std::uint32_t>(1, header.keyframe_interval);
+  grid_width = static_cast<int>(header.grid_width);
+  grid_height = static_cast<int>(header.grid_height);
+  index.clear();
+  failed = false;
+  Flush(true);
+  return !failed;
+}
+
+bool ReplayWriter::Close() {
+  if (file == nullptr) {
+    return true;
+  }
+  PutKey(ticks_recorded, ReplayRecord::Kind::kEnd);
+
+  std::uint64_t const index_offset = flushed_bytes + buffer.size();
+  for (ReplayIndexEntry const &entry : index) {
+    PutLittleEndian(buffer, entry.tick, 8);
+    PutLittleEndian(buffer, entry.offset, 8);
+    Flush(false);
+  }
+  PutLittleEndian(buffer, index_offset, 8);
+  PutLittleEndian(buffer, index.size(), 8);
+  PutLittleEndian(buffer, ticks_recorded, 8);
+  for (char const c : kIndexMagic) {
+    buffer.push_back(static_cast<unsigned char>(c));
+  }
+
+  Flush(true);
+  failed |= std::fclose(file) != 0;
+  file = nullptr;
+  return !failed;
+}
+
+void ReplayWriter::RecordKeyframe(std::uint64_t tick, Simulation &simulation) {
+  if (file == nullptr) {
+    return;
+  }
+  simulation.SaveState(keyframe_state);
+  simulation.RestoreState(keyframe_state);
+  EncodeKeyframe(keyframe_state, grid_width, grid_height, keyframe_bytes);
+
+  index.push_back({tick, flushed_bytes + buffer.size()});
+  PutKey(tick, ReplayRecord::Kind::kKeyframe);
+  PutVarint(buffer, keyframe_bytes.size());
+  buffer.insert(buffer.end(), keyframe_bytes.begin(), keyframe_bytes.end());
+  Flush(false);
+}
+
+void ReplayWriter::RecordCommand(std::uint64_t tick,
+                                 GameCommand const &command) {
+  if (file == nullptr) {
+    return;
+  }
+  PutKey(tick, ReplayRecord::Kind::kCommand);
+  buffer.push_back(static_cast<unsigned char>(
+      static_cast<int>(command.type) |
+      (static_cast<int>(command.direction) << 2)));
+  Flush(false);
+}
+
+void ReplayWriter::RecordChecksum(std::uint64_t tick, std::uint32_t checksum) {
+  if (file == nullptr) {
+    return;
+  }
+  PutKey(tick, ReplayRecord::Kind::kChecksum);
+  PutLittleEndian(buffer, checksum, 4);
+  ticks_recorded = tick + 1;
+  Flush(false);
+}
+
+void ReplayWriter::PutKey(std::uint64_t tick, ReplayRecord::Kind kind) {
+  std::uint64_t const delta = tick >= last_tick ? tick - last_tick : 0;
+  PutVarint(buffer, (delta << 2) | static_cast<std::uint64_t>(kind));
+  last_tick = tick;
+}
+
+void ReplayWriter::Flush(bool force) {
+  if (buffer.empty() || (!force && buffer.size() < kFlushThreshold)) {
+    return;
+  }
+  failed |= std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size();
+  failed |= std::fflush(file) != 0;
+  flushed_bytes += buffer.size();
+  buffer.clear();
+}
+
+bool ReplayReader::Open(std::string const &path) {
+  position = 0;
+  last_tick = 0;
+  tick_count = 0;
+  corrupt = false;
+  mapped_index = nullptr;
+  mapped_index_count = 0;
+  scanned_index.clear();
+  if (!mapping.Open(path)) {
+    return false;
+  }
+
+  unsigned char const *data = mapping.Data();
+  if (mapping.Size() < ReplayHeader::kSize ||
+      std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+    mapping.Close();
+    return false;
+  }
+  unsigned char const *fields = data + sizeof(kMagic);
+  header.version = static_cast<std::uint32_t>(GetLittleEndian(fields, 4));
+  header.grid_width = static_cast<std::uint32_t>(GetLittleEndian(fields + 4, 4));
+  header.grid_height = static_cast<std::uint32_t>(GetLittleEndian(fields + 8, 4));
+  header.ticks_per_second =
+      static_cast<std::uint32_t>(GetLittleEndian(fields + 12, 4));
+  header.keyframe_interval =
+      static_cast<std::uint32_t>(GetLittleEndian(fields + 16, 4));
+  header.seed = GetLittleEndian(fields + 24, 8);
+  // Everything below trusts the header, so a board or tick rate the game
+  // would refuse on its command line is refused here too.
+  if (header.version != ReplayHeader::kVersion ||
+      !ValidGridSize(header.grid_width, header.grid_height) ||
+      !ValidTicksPerSecond(header.ticks_per_second) ||
+      header.keyframe_interval == 0) {
+    mapping.Close();
+    return false;
+  }
+
+  position = ReplayHeader::kSize;
+  if (!ReadIndexFooter()) {
+    records_end = mapping.Size();
+    ScanRecords();
+  }
+  return true;
+}
+
+bool ReplayReader::ReadIndexFooter() {
+  std::size_t const size = mapping.Size();
+  if (size < ReplayHeader::kSize + kTrailerSize) {
+    return false;
+  }
+  unsigned char const *trailer = mapping.Data() + size - kTrailerSize;
+  if (std::memcmp(trailer + 24, kIndexMagic, sizeof(kIndexMagic)) != 0) {
+    return false;
+  }
+  std::uint64_t const offset = GetLittleEndian(trailer, 8);
+  std::uint64_t const count = GetLittleEndian(trailer + 8, 8);
+  std::uint64_t const index_end = size - kTrailerSize;
+  if (offset < ReplayHeader::kSize || offset > index_end ||
+      (index_end - offset) % kIndexEntrySize != 0 ||
+      (index_end - offset) / kIndexEntrySize != count) {
+    return false;
+  }
+  records_end = static_cast<std::size_t>(offset);
+  mapped_index = mapping.Data() + offset;
+  mapped_index_count = static_cast<std::size_t>(count);
+  tick_count = GetLittleEndian(trailer + 16, 8);
+  return true;
+}
+
+void ReplayReader::ScanRecords() {
+  ReplayRecord record;
+  std::size_t record_start = position;
+  while (Next(record)) {
+    if (record.kind == ReplayRecord::Kind::kKeyframe) {
+      scanned_index.push_back({record.tick, record_start});
+    } else if (record.kind == ReplayRecord::Kind::kChecksum) {
+      tick_count = record.tick + 1;
+    } else if (record.kind == ReplayRecord::Kind::kEnd) {
+      tick_count = record.tick;
+    }
+    record_start = position;
+  }
+  position = ReplayHeader::kSize;
+  last_tick = 0;
+  corrupt = false;  // Reported again when playback gets there
+}
+
+std::size_t ReplayReader::KeyframeCount() const {
+  return mapped_index != nullptr ? mapped_index_count : scanned_index.size();
+}
+
+ReplayIndexEntry ReplayReader::Keyframe(std::size_t i) const {
+  if (mapped_index == nullptr) {
+    return scanned_index[i];
+  }
+  unsigned char const *entry = mapped_index + i * kIndexEntrySize;
+  return {GetLittleEndian(entry, 8), GetLittleEndian(entry + 8, 8)};
+}
+
+std::size_t ReplayReader::FindKeyframe(std::uint64_t tick) const {
+  // First keyframe after `tick`, then step back one
+  std::size_t low = 0;
+  std::size_t high = KeyframeCount();
+  while (low < high) {
+    std::size_t const middle = low + (high - low) / 2;
+    if (Keyframe(middle).tick <= tick) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low == 0 ? KeyframeCount() : low - 1;
+}
+
+void ReplayReader::Seek(ReplayIndexEntry const &entry) {
+  corrupt = false;
+  position = static_cast<std::size_t>(
+      std::min<std::uint64_t>(entry.offset, records_end));
+  // The key holds the keyframe's distance from the record before it
+  std::size_t const key_start = position;
+  std::uint64_t key = 0;
+  if (ReadVarint(key)) {
+    last_tick = entry.tick - (key >> 2);
+  }
+  position = key_start;
+}
+
+bool ReplayReader::ReadVarint(std::uint64_t &value) {
+  bool overlong = false;
+  if (GetVarint(mapping.Data(), records_end, position, value, overlong)) {
+    return true;
+  }
+  corrupt |= overlong;
+  return false;
+}
+
+bool ReplayReader::Next(ReplayRecord &record) {
+  if (corrupt || position >= records_end) {
+    return false;
+  }
+  unsigned char const *data = mapping.Data();
+  std::uint64_t key;
+  if (!ReadVarint(key)) {
+    return false;
+  }
+  last_tick += key >> 2;
+  record.tick = last_tick;
+  switch (key & 3) {
+    case 0: {
+      if (position >= records_end) {
+        return false;
+      }
+      unsigned char const byte = data[position++];
+      if ((byte >> 4) != 0) {
+        corrupt = true;
+        return false;
+      }
+      record.kind = ReplayRecord::Kind::kCommand;
+      record.command.type = static_cast<GameCommand::Type>(byte & 3);
+      record.command.direction =
+          static_cast<Snake::Direction>((byte >> 2) & 3);
+      record.command.timestamp = 0;
+      return true;
+    }
+    case 1:
+      if (records_end - position < 4) {
+        position = records_end;
+        return false;
+      }
+      record.kind = ReplayRecord::Kind::kChecksum;
+      record.checksum =
+          static_cast<std::uint32_t>(GetLittleEndian(data + position, 4));
+      position += 4;
+      return true;
+    case 2:
+      record.kind = ReplayRecord::Kind::kEnd;
+      return true;
+    default: {
+      std::uint64_t size;
+      if (!ReadVarint(size)) {
+        return false;
+      }
+      if (size > records_end - position) {
+        position = records_end;
+        return false;
+      }
+      record.kind = ReplayRecord::Kind::kKeyframe;
+      record.keyframe = data + position;
+      record.keyframe_size = static_cast<std::size_t>(size);
+      position += record.keyframe_size;
+      return true;
+    }
+  }
+}
+
+ReplayPlayer::ReplayPlayer(ReplayReader reader) : reader(std::move(reader)) {}
+
+Simulation ReplayPlayer::MakeSimulation() const {
+  ReplayHeader const &header = reader.Header();
+  return Simulation(static_cast<int>(header.grid_width),
+                    static_cast<int>(header.grid_height), header.seed);
+}
+
+ReplayPlayer::Status ReplayPlayer::Step(Simulation &simulation,
+                                        TickEvents &events) {
+  events = TickEvents{};
+  if (status != Status::kTicked) {
+    return status;
+  }
+
+  // This tick's keyframe and commands, then its checksum
+  ReplayRecord record;
+  while (true) {
+    if (!reader.Next(record)) {
+      status = reader.Corrupt() ? Status::kCorrupt : Status::kTruncated;
+      return status;
+    }
+    if (record.kind == ReplayRecord::Kind::kChecksum ||
+        record.kind == ReplayRecord::Kind::kEnd) {
+      break;
+    }
+    if (record.tick != tick) {
+      status = Status::kCorrupt;
+      return status;
+    }
+    if (record.kind == ReplayRecord::Kind::kCommand) {
+      simulation.Apply(record.command);
+    } else if (!RestoreKeyframe(record, simulation)) {
+      status = Status::kCorrupt;
+      return status;
+    }
+  }
+  if (record.kind == ReplayRecord::Kind::kEnd) {
+    status = record.tick == tick ? Status::kFinished : Status::kCorrupt;
+    return status;
+  }
+  if (record.tick != tick) {
+    status = Status::kCorrupt;
+    return status;
+  }
+
+  events = simulation.Tick();
+  expected = record.checksum;
+  actual = simulation.Checksum();
+  if (actual != expected) {
+    status = Status::kDesync;
+    return status;
+  }
+  ++tick;
+  return status;
+}
+
+ReplayPlayer::Status ReplayPlayer::SeekTo(Simulation &simulation,
+                                          std::uint64_t target) {
+  target = std::min(target, reader.TickCount());
+  std::size_t const keyframe = reader.FindKeyframe(target);
+  if (keyframe == reader.KeyframeCount()) {
+    status = Status::kCorrupt;  // Every replay starts with a keyframe
+    return status;
+  }
+  ReplayIndexEntry const entry = reader.Keyframe(keyframe);
+  reader.Seek(entry);
+  tick = entry.tick;
+  ReplayRecord record;
+  if (!reader.Next(record) || record.kind != ReplayRecord::Kind::kKeyframe ||
+      record.tick != tick || !RestoreKeyframe(record, simulation)) {
+    status = Status::kCorrupt;
+    return status;
+  }
+
+  status = Status::kTicked;
+  TickEvents events;
+  while (tick < target && Step(simulation, events) == Status::kTicked) {
+  }
+  return status;
+}
+
+bool ReplayPlayer::RestoreKeyframe(ReplayRecord const &record,
+                                   Simulation &simulation) {
+  if (!DecodeKeyframe(record.keyframe, record.keyframe_size,
+                      static_cast<int>(Header().grid_width),
+                      static_cast<int>(Header().grid_height),
+                      keyframe_state)) {
+    return false;
+  }
+  simulation.RestoreState(keyframe_state);
+  return true;
+}
+
+char const *ReplayPlayer::StatusName(Status status) {
+  switch (status) {
+    case Status::kTicked:
+      return "playing";
+    case Status::kFinished:
+      return "finished";
+    case Status::kTruncated:
+      return "truncated";
+    case Status::kCorrupt:
+      return "corrupt";
+    case Status::kDesync:
+      return "desync";
+  }
+  return "unknown";
+}
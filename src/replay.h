@@ -0,0 +1,232 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Deterministic Replay Recording and Playback
+ * ============================================================================
+ *
+ * File: replay.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * A game is fully determined by its seed, grid size and the commands
+ * applied at each tick, so that is all a replay needs. The file starts
+ * with a fixed header and continues with a stream of records, each keyed
+ * by one varint:
+ *
+ *   key = (ticks since the previous record << 2) | kind
+ *
+ * A command record is followed by one byte: the command type in the low
+ * two bits and the direction in the next two. A checksum record is
+ * followed by the 32-bit Simulation::Checksum() after that tick. An end
+ * record marks a cleanly closed file; its tick is the number of ticks
+ * played. Every tick gets a checksum, so a ticking replay costs five
+ * bytes per tick and playback catches a desync on the tick it happens.
+ *
+ * Every keyframe_interval ticks a keyframe record (a varint length and a
+ * compact SimulationState) comes before that tick's commands. The body is
+ * stored as its tail cell plus two bits per step, with any step that is
+ * not to a neighbouring cell listed separately. A closed file ends with an
+ * index of every keyframe's tick and offset (16 bytes each) and a
+ * 32-byte trailer:
+ *
+ *   index offset, keyframe count, tick count (u64 each), "SNKINDEX"
+ *
+ * The reader maps the file, so seeking is a binary search over the index
+ * plus at most one keyframe interval of simulation, however long the
+ * replay is. A file cut short by a crash has no index; the reader then
+ * finds its keyframes with one pass over the records.
+ *
+ * Both recording and playback re-base the simulation on every keyframe
+ * they pass (see Simulation::RestoreState()), so playing from the start
+ * and seeking reach identical states.
+ *
+ * All multi-byte fields are little-endian. The writer streams records to
+ * disk as the game runs; a file cut short by a crash still plays back up
+ * to its last flushed tick.
+ *
+ * SDL-free: the game records and plays on its simulation thread, and
+ * snake_headless verifies replays at full speed.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "game_command.h"
+#include "mapped_file.h"
+#include "simulation.h"
+
+struct ReplayHeader {
+  // Bump whenever the record layout or the simulation rules change.
+  static constexpr std::uint32_t kVersion{2};
+  static constexpr std::size_t kSize{40};
+
+  std::uint32_t version{kVersion};
+  std::uint32_t grid_width{0};
+  std::uint32_t grid_height{0};
+  std::uint32_t ticks_per_second{0};
+  std::uint32_t keyframe_interval{600};
+  std::uint64_t seed{0};
+};
+
+struct ReplayRecord {
+  enum class Kind { kCommand = 0, kChecksum = 1, kEnd = 2, kKeyframe = 3 };
+
+  Kind kind{Kind::kCommand};
+  std::uint64_t tick{0};
+  GameCommand command;        // kCommand
+  std::uint32_t checksum{0};  // kChecksum
+  // kKeyframe: the encoded state, pointing into the reader's mapping.
+  unsigned char const *keyframe{nullptr};
+  std::size_t keyframe_size{0};
+};
+
+struct ReplayIndexEntry {
+  std::uint64_t tick{0};
+  std::uint64_t offset{0};  // Of the keyframe record's key
+};
+
+class ReplayWriter {
+ public:
+  ReplayWriter() = default;
+  ~ReplayWriter() { Close(); }
+  ReplayWriter(ReplayWriter const &) = delete;
+  ReplayWriter &operator=(ReplayWriter const &) = delete;
+
+  // Creates `path` and writes the header. Returns false if the file
+  // cannot be created.
+  bool Open(std::string const &path, ReplayHeader const &header);
+  // Writes the end record and closes the file; a no-op if not open.
+  // Returns false if any write failed.
+  bool Close();
+  bool IsOpen() const { return file != nullptr; }
+
+  // Records must arrive in tick order: a tick's keyframe, its commands
+  // (applied before it), then its checksum.
+  bool KeyframeDue(std::uint64_t tick) const {
+    return file != nullptr && tick % keyframe_interval == 0;
+  }
+  // Saves `simulation` as the keyframe for `tick` and re-bases it on the
+  // saved state, exactly as playback will when it reaches this keyframe.
+  void RecordKeyframe(std::uint64_t tick, Simulation &simulation);
+  void RecordCommand(std::uint64_t tick, GameCommand const &command);
+  void RecordChecksum(std::uint64_t tick, std::uint32_t checksum);
+
+ private:
+  void PutKey(std::uint64_t tick, ReplayRecord::Kind kind);
+  // Hands the buffered records to the OS once a few kilobytes are pending.
+  void Flush(bool force);
+
+  std::FILE *file{nullptr};
+  std::vector<unsigned char> buffer;
+  std::uint64_t flushed_bytes{0};
+  std::uint64_t last_tick{0};       // Tick of the previous record
+  std::uint64_t ticks_recorded{0};  // Tick of the end record
+  std::uint32_t keyframe_interval{1};
+  int grid_width{0};
+  int grid_height{0};
+  std::vector<ReplayIndexEntry> index;
+  SimulationState keyframe_state;
+  std::vector<unsigned char> keyframe_bytes;
+  bool failed{false};
+};
+
+class ReplayReader {
+ public:
+  // Maps `path` and checks its header. Returns false if the file is
+  // missing or not a replay of this version.
+  bool Open(std::string const &path);
+
+  ReplayHeader const &Header() const { return header; }
+  // Ticks recorded: the end record's tick, or for a file that was never
+  // closed, one past its last checksum.
+  std::uint64_t TickCount() const { return tick_count; }
+
+  // Decodes the next record. Returns false at the end of the data or on a
+  // malformed record; Corrupt() tells the two apart.
+  bool Next(ReplayRecord &record);
+  bool Corrupt() const { return corrupt; }
+
+  std::size_t KeyframeCount() const;
+  ReplayIndexEntry Keyframe(std::size_t i) const;
+  // The last keyframe at or before `tick`, or KeyframeCount() if none.
+  std::size_t FindKeyframe(std::uint64_t tick) const;
+  // Makes the keyframe `entry` describes the next record.
+  void Seek(ReplayIndexEntry const &entry);
+
+ private:
+  bool ReadVarint(std::uint64_t &value);
+  bool ReadIndexFooter();
+  // Fills `scanned_index` and `tick_count` from the records themselves.
+  void ScanRecords();
+
+  MappedFile mapping;
+  ReplayHeader header;
+  std::size_t records_end{0};
+  std::size_t position{0};
+  std::uint64_t last_tick{0};
+  std::uint64_t tick_count{0};
+  bool corrupt{false};
+
+  // Either the footer inside the mapping or, without one, a scanned copy.
+  unsigned char const *mapped_index{nullptr};
+  std::size_t mapped_index_count{0};
+  std::vector<ReplayIndexEntry> scanned_index;
+};
+
+// Drives a Simulation from a replay one tick at a time, checking every
+// tick against its recorded checksum.
+class ReplayPlayer {
+ public:
+  enum class Status {
+    kTicked,     // One tick played and verified
+    kFinished,   // Reached the end record
+    kTruncated,  // The data stops without an end record
+    kCorrupt,    // A malformed or out-of-order record
+    kDesync,     // The checksum after Tick() differs from the recording
+  };
+
+  explicit ReplayPlayer(ReplayReader reader);
+
+  ReplayHeader const &Header() const { return reader.Header(); }
+  // A fresh simulation for this replay's seed and grid.
+  Simulation MakeSimulation() const;
+
+  // Applies the next tick's keyframe and commands, ticks `simulation` and
+  // verifies the result. `events` receives the tick's events. After any
+  // status other than kTicked, further calls return the same status.
+  Status Step(Simulation &simulation, TickEvents &events);
+
+  // Puts `simulation` in the state it had before tick `target` (clamped
+  // to the replay's length): restores the last keyframe at or before it,
+  // then plays the remaining ticks. Clears a previous end or desync.
+  Status SeekTo(Simulation &simulation, std::uint64_t target);
+
+  // The tick Step() plays next, or the tick that failed.
+  std::uint64_t Tick() const { return tick; }
+  std::uint64_t TickCount() const { return reader.TickCount(); }
+  std::uint32_t ExpectedChecksum() const { return expected; }
+  std::uint32_t ActualChecksum() const { return actual; }
+
+  static char const *StatusName(Status status);
+
+ private:
+  bool RestoreKeyframe(ReplayRecord const &record, Simulation &simulation);
+
+  ReplayReader reader;
+  SimulationState keyframe_state;
+  std::uint64_t tick{0};
+  std::uint32_t expected{0};
+  std::uint32_t actual{0};
+  Status status{Status::kTicked};
+};
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Fixed-Capacity Ring Buffer
+ * ============================================================================
+ * 
+ * File: ring_buffer.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Circular buffer with head and tail indices over storage allocated once at
+ * construction. Pushing at the back and popping from the front are O(1) and
+ * never move existing elements, which makes it a good fit for the snake
+ * body: every cell step appends the old head and drops the tail.
+ * 
+ * Elements are indexed and iterated in insertion order (front/tail first).
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+template <typename T>
+class RingBuffer {
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T const *;
+    using reference = T const &;
+
+    const_iterator(RingBuffer const *ring, std::size_t offset)
+        : ring(ring), offset(offset) {}
+
+    reference operator*() const { return (*ring)[offset]; }
+    pointer operator->() const { return &(*ring)[offset]; }
+    const_iterator &operator++() {
+      ++offset;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator previous = *this;
+      ++offset;
+      return previous;
+    }
+    bool operator==(const_iterator const &other) const {
+      return offset == other.offset;
+    }
+    bool operator!=(const_iterator const &other) const {
+      return offset != other.offset;
+    }
+
+   private:
+    RingBuffer const *ring;
+    std::size_t offset;
+  };
+
+  explicit RingBuffer(std::size_t capacity) : storage(capacity) {}
+
+  void push_back(T const &value) {
+    assert(count < storage.size());
+    storage[back_index] = value;
+    back_index = Advance(back_index);
+    ++count;
+  }
+
+  void pop_front() {
+    assert(count > 0);
+    front_index = Advance(front_index);
+    --count;
+  }
+
+  void clear() {
+    front_index = 0;
+    back_index = 0;
+    count = 0;
+  }
+
+  T const &front() const { return storage[front_index]; }
+  T const &back() const { return (*this)[count - 1]; }
+
+  // Logical index: 0 is the front (oldest element), size() - 1 the back.
+  T const &operator[](std::size_t i) const {
+    std::size_t slot = front_index + i;
+    if (slot >= storage.size()) {
+      slot -= storage.size();
+    }
+    return storage[slot];
+  }
+
+  std::size_t size() const { return count; }
+  std::size_t capacity() const { return storage.size(); }
+  bool empty() const { return count == 0; }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, count); }
+
+ private:
+  std::size_t Advance(std::size_t index) const {
+    return index + 1 == storage.size() ? 0 : index + 1;
+  }
+
+  std::vector<T> storage;
+  std::size_t front_index{0};
+  std::size_t back_index{0};
+  std::size_t count{0};
+};
+
+#endif
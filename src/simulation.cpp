@@ -0,0 +1,275 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Headless Game Simulation Implementation
+ * ============================================================================
+ * 
+ * File: simulation.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "simulation.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// FNV-1a, fed one 64-bit field at a time.
+class Fnv1a {
+ public:
+  void Add(std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      hash = (hash ^ ((value >> (8 * i)) & 0xff)) * 0x100000001b3ULL;
+    }
+  }
+  void Add(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Add(static_cast<std::uint64_t>(bits));
+  }
+  std::uint32_t Result() const {
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+  }
+
+ private:
+  std::uint64_t hash{0xcbf29ce484222325ULL};
+};
+
+std::uint64_t PackCell(Point cell) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x))
+          << 32) |
+         static_cast<std::uint32_t>(cell.y);
+}
+
+}  // namespace
+
+Simulation::Simulation(int grid_width, int grid_height, std::uint64_t seed)
+    : grid_width(grid_width),
+      grid_height(grid_height),
+      snake(grid_width, grid_height),
+      rng(seed) {
+  PlaceFood();
+}
+
+TickEvents Simulation::Tick() {
+  TickEvents events;
+  if (game_state != GameState::Playing) {
+    return events;
+  }
+
+  ApplyQueuedTurn(events);
+  snake.Update();
+  if (!snake.alive) {
+    game_state = GameState::GameOver;
+    events.died = true;
+    return events;
+  }
+
+  int new_x = static_cast<int>(snake.head_x);
+  int new_y = static_cast<int>(snake.head_y);
+
+  // Check if there's food over here
+  if (food.x == new_x && food.y == new_y) {
+    score++;
+    events.ate_food = true;
+    events.food_eaten_at = food;
+    // Grow snake and increase speed.
+    snake.GrowBody();
+    snake.speed += 0.02;
+    if (!PlaceFood()) {
+      // The snake covers every cell: nothing left to eat.
+      game_state = GameState::Won;
+      events.won = true;
+    }
+  }
+  return events;
+}
+
+void Simulation::Start() {
+  if (game_state == GameState::StartScreen) {
+    game_state = GameState::Playing;
+  }
+}
+
+void Simulation::TogglePause() {
+  if (game_state == GameState::Playing) {
+    game_state = GameState::Paused;
+  } else if (game_state == GameState::Paused) {
+    game_state = GameState::Playing;
+  }
+}
+
+void Simulation::Restart() {
+  // Reset game state
+  game_state = GameState::Playing;
+  score = 0;
+
+  // Reset snake, reusing its buffers
+  snake.Reset();
+  queued_turn_count = 0;
+  last_turn_cell = ~std::uint64_t{0};
+
+  // Place new food
+  PlaceFood();
+}
+
+bool Simulation::IsReversal(Snake::Direction current,
+                            Snake::Direction next) const {
+  Snake::Direction opposite = Snake::Direction::kUp;
+  switch (current) {
+    case Snake::Direction::kUp:
+      opposite = Snake::Direction::kDown;
+      break;
+    case Snake::Direction::kDown:
+      opposite = Snake::Direction::kUp;
+      break;
+    case Snake::Direction::kLeft:
+      opposite = Snake::Direction::kRight;
+      break;
+    case Snake::Direction::kRight:
+      opposite = Snake::Direction::kLeft;
+      break;
+  }
+  return next == opposite && snake.size > 1;
+}
+
+void Simulation::Turn(Snake::Direction direction, std::uint64_t stamp) {
+  // Judge the turn against the direction it will follow
+  Snake::Direction const after =
+      queued_turn_count > 0 ? queued_turns[queued_turn_count - 1].direction
+                            : snake.direction;
+  if (direction == after || IsReversal(after, direction) ||
+      queued_turn_count == kMaxQueuedTurns) {
+    return;
+  }
+  queued_turns[queued_turn_count++] = {direction, stamp};
+}
+
+void Simulation::ApplyQueuedTurn(TickEvents &events) {
+  if (queued_turn_count == 0 || snake.body_pushes == last_turn_cell) {
+    return;
+  }
+  QueuedTurn const turn = queued_turns[0];
+  std::copy(queued_turns.begin() + 1,
+            queued_turns.begin() + queued_turn_count, queued_turns.begin());
+  --queued_turn_count;
+
+  // The snake may have grown since the turn was queued
+  if (turn.direction == snake.direction ||
+      IsReversal(snake.direction, turn.direction)) {
+    return;
+  }
+  snake.direction = turn.direction;
+  last_turn_cell = snake.body_pushes;
+  events.turned = true;
+  events.turn_stamp = turn.stamp;
+}
+
+void Simulation::Apply(GameCommand const &command) {
+  switch (command.type) {
+    case GameCommand::Type::kStart:
+      Start();
+      break;
+    case GameCommand::Type::kTogglePause:
+      TogglePause();
+      break;
+    case GameCommand::Type::kRestart:
+      Restart();
+      break;
+    case GameCommand::Type::kTurn:
+      if (game_state == GameState::Playing) {
+        Turn(command.direction, command.timestamp);
+      }
+      break;
+  }
+}
+
+std::uint32_t Simulation::Checksum() const {
+  Fnv1a fnv;
+  fnv.Add(static_cast<std::uint64_t>(game_state));
+  fnv.Add(static_cast<std::uint64_t>(score));
+  fnv.Add(snake.head_x);
+  fnv.Add(snake.head_y);
+  fnv.Add(snake.speed);
+  fnv.Add(static_cast<std::uint64_t>(snake.direction));
+  fnv.Add(static_cast<std::uint64_t>(snake.size));
+  fnv.Add(static_cast<std::uint64_t>(snake.alive) |
+          (static_cast<std::uint64_t>(snake.Growing()) << 1));
+  fnv.Add(snake.body_pushes);
+  if (!snake.body.empty()) {
+    fnv.Add(PackCell(snake.body.front()));
+    fnv.Add(PackCell(snake.body.back()));
+  }
+  fnv.Add(PackCell(food));
+  for (std::size_t i = 0; i < queued_turn_count; ++i) {
+    fnv.Add(static_cast<std::uint64_t>(queued_turns[i].direction));
+  }
+  fnv.Add(last_turn_cell);
+  fnv.Add(rng.State());
+  return fnv.Result();
+}
+
+void Simulation::SaveState(SimulationState &state) const {
+  state.game_state = game_state;
+  state.score = score;
+  state.food = food;
+  state.rng_state = rng.State();
+  state.rng_increment = rng.Increment();
+  state.queued_turns.clear();
+  for (std::size_t i = 0; i < queued_turn_count; ++i) {
+    state.queued_turns.push_back(queued_turns[i].direction);
+  }
+  state.last_turn_cell = last_turn_cell;
+
+  state.direction = snake.direction;
+  state.speed = snake.speed;
+  state.size = snake.size;
+  state.alive = snake.alive;
+  state.growing = snake.Growing();
+  state.head_x = snake.head_x;
+  state.head_y = snake.head_y;
+  state.prev_head_x = snake.prev_head_x;
+  state.prev_head_y = snake.prev_head_y;
+  state.body_pushes = snake.body_pushes;
+  state.body.assign(snake.body.begin(), snake.body.end());
+}
+
+void Simulation::RestoreState(SimulationState const &state) {
+  game_state = state.game_state;
+  score = state.score;
+  food = state.food;
+  rng.Restore(state.rng_state, state.rng_increment);
+  queued_turn_count = std::min(state.queued_turns.size(), kMaxQueuedTurns);
+  for (std::size_t i = 0; i < queued_turn_count; ++i) {
+    queued_turns[i] = {state.queued_turns[i], 0};
+  }
+  last_turn_cell = state.last_turn_cell;
+
+  snake.direction = state.direction;
+  snake.speed = state.speed;
+  snake.size = state.size;
+  snake.alive = state.alive;
+  snake.head_x = state.head_x;
+  snake.head_y = state.head_y;
+  snake.prev_head_x = state.prev_head_x;
+  snake.prev_head_y = state.prev_head_y;
+  snake.body_pushes = state.body_pushes;
+  snake.RestoreBody(state.body, state.growing);
+}
+
+bool Simulation::PlaceFood() {
+  // Draw straight from the snake's free-cell index: one random number and
+  // no retries, however crowded the board is.
+  OccupancyGrid const &occupancy = snake.Occupancy();
+  if (occupancy.FreeCount() == 0) {
+    return false;
+  }
+  std::uint32_t const cell =
+      rng.UniformIndex(static_cast<std::uint32_t>(occupancy.FreeCount()));
+  occupancy.FreeCell(cell, food.x, food.y);
+  return true;
+}
@@ -0,0 +1,149 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Headless Game Simulation
+ * ============================================================================
+ * 
+ * File: simulation.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * The complete rule set of the game with no window, audio or clock: snake
+ * movement and growth, collision, food placement, scoring and the
+ * Start/Playing/Paused/GameOver/Won state machine. Front ends advance it
+ * one fixed tick at a time and react to the events each tick reports.
+ * 
+ * This is the heart of the snake_core library, which has no SDL
+ * dependency and can be driven from tools, benchmarks and bots.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "game_command.h"
+#include "game_state.h"
+#include "point.h"
+#include "rng.h"
+#include "snake.h"
+
+// What happened during one call to Simulation::Tick().
+struct TickEvents {
+  bool ate_food{false};
+  bool died{false};
+  bool won{false};
+  Point food_eaten_at{0, 0};
+  // A queued turn took effect this tick; `turn_stamp` is the value passed
+  // to Turn() with it.
+  bool turned{false};
+  std::uint64_t turn_stamp{0};
+};
+
+// Everything that decides how a game continues; see Simulation::SaveState().
+struct SimulationState {
+  GameState game_state{GameState::StartScreen};
+  int score{0};
+  Point food{0, 0};
+  std::uint64_t rng_state{0};
+  std::uint64_t rng_increment{0};
+  std::vector<Snake::Direction> queued_turns;
+  std::uint64_t last_turn_cell{0};
+
+  Snake::Direction direction{Snake::Direction::kUp};
+  float speed{0.0f};
+  int size{1};
+  bool alive{true};
+  bool growing{false};
+  float head_x{0.0f};
+  float head_y{0.0f};
+  float prev_head_x{0.0f};
+  float prev_head_y{0.0f};
+  std::uint64_t body_pushes{0};
+  std::vector<Point> body;  // Tail first
+};
+
+class Simulation {
+ public:
+  // Each game owns its RNG, so a given seed always plays out the same way.
+  Simulation(int grid_width, int grid_height, std::uint64_t seed);
+
+  // Advances the game by one fixed step. Does nothing unless Playing.
+  TickEvents Tick();
+
+  // Moves the food to a uniformly random free cell. Returns false when no
+  // free cell is left, i.e. the board is full.
+  bool PlaceFood();
+
+  // State machine commands.
+  void Start();
+  void TogglePause();
+  void Restart();
+  // Queues a turn. Queued turns take effect at most one per cell: the
+  // first at the next tick, each later one once the head has entered a new
+  // cell. A fast double turn within one cell is kept rather than lost, and
+  // it can never fold the head back onto the neck. Turns that repeat or
+  // reverse the direction they follow are refused, as are turns beyond
+  // kMaxQueuedTurns. `stamp` is opaque and comes back in TickEvents.
+  void Turn(Snake::Direction direction, std::uint64_t stamp = 0);
+  // Dispatches a queued player command to the calls above.
+  void Apply(GameCommand const &command);
+
+  GameState GetState() const { return game_state; }
+  Snake const &GetSnake() const { return snake; }
+  Snake &GetSnake() { return snake; }
+  Point const &GetFood() const { return food; }
+  int GetScore() const { return score; }
+  int GetSize() const { return snake.size; }
+  int GridWidth() const { return grid_width; }
+  int GridHeight() const { return grid_height; }
+  std::size_t QueuedTurns() const { return queued_turn_count; }
+  // Hash of everything that decides later ticks: state, score, the head's
+  // exact position, speed and direction, the body's length and end cells,
+  // food, queued turns and the RNG. Constant time, so replays can check
+  // every tick; the body's middle is implied by the head's past path.
+  std::uint32_t Checksum() const;
+
+  // Copies the game state into `state`, reusing its storage.
+  void SaveState(SimulationState &state) const;
+  // Continues from a saved state. The free-cell index behind food placement
+  // is rebuilt in a canonical order rather than restored, so a game only
+  // continues identically if the saved game was re-based on the same state
+  // at that tick (as replay keyframes do). `state` must fit the grid.
+  void RestoreState(SimulationState const &state);
+
+  static constexpr std::size_t kMaxQueuedTurns{3};
+
+ private:
+  struct QueuedTurn {
+    Snake::Direction direction;
+    std::uint64_t stamp;
+  };
+
+  // True if `next` would send a snake heading `current` back onto itself.
+  bool IsReversal(Snake::Direction current, Snake::Direction next) const;
+  void ApplyQueuedTurn(TickEvents &events);
+
+  int grid_width;
+  int grid_height;
+  Snake snake;
+  Point food{0, 0};
+  GameState game_state{GameState::StartScreen};
+  int score{0};
+
+  std::array<QueuedTurn, kMaxQueuedTurns> queued_turns{};
+  std::size_t queued_turn_count{0};
+  // Snake::body_pushes when the last turn took effect; another turn waits
+  // until the head enters a new cell and this no longer matches.
+  std::uint64_t last_turn_cell{~std::uint64_t{0}};
+
+  Rng rng;
+};
+
+#endif
@@ -3,17 +3,19 @@
 #include <iostream>
 
 void Snake::Update() {
-  SDL_Point prev_cell{
+  prev_head_x = head_x;
+  prev_head_y = head_y;
+
+  Point prev_cell{
       static_cast<int>(head_x),
       static_cast<int>(
           head_y)};  // We first capture the head's cell before updating.
   UpdateHead();
-  SDL_Point current_cell{
+  Point current_cell{
       static_cast<int>(head_x),
       static_cast<int>(head_y)};  // Capture the head's cell after updating.
 
-  // Update all of the body vector items if the snake head has moved to a new
-  // cell.
+  // Update the body if the snake head has moved to a new cell.
   if (current_cell.x != prev_cell.x || current_cell.y != prev_cell.y) {
     UpdateBody(current_cell, prev_cell);
   }
@@ -43,37 +45,52 @@ void Snake::UpdateHead() {
   head_y = fmod(head_y + grid_height, grid_height);
 }
 
-void Snake::UpdateBody(SDL_Point &current_head_cell, SDL_Point &prev_head_cell) {
-  // Add previous head location to vector
+void Snake::UpdateBody(Point &current_head_cell, Point &prev_head_cell) {
+  // Add previous head location to the body ring. Its cell is already marked in the
+  // occupancy map from when it was the head.
   body.push_back(prev_head_cell);
+  ++body_pushes;
 
   if (!growing) {
-    // Remove the tail from the vector.
-    body.erase(body.begin());
+    // Remove the tail from the ring and free its cell.
+    occupancy.Clear(body.front().x, body.front().y);
+    body.pop_front();
   } else {
     growing = false;
     size++;
   }
 
-  // Check if the snake has died.
-  for (auto const &item : body) {
-    if (current_head_cell.x == item.x && current_head_cell.y == item.y) {
-      alive = false;
-    }
+  // Check if the snake has died. The tail has already been released, so
+  // moving into the cell it just vacated is still legal.
+  if (occupancy.Test(current_head_cell.x, current_head_cell.y)) {
+    alive = false;
+  } else {
+    occupancy.Set(current_head_cell.x, current_head_cell.y);
   }
 }
 
-void Snake::GrowBody() { growing = true; }
+void Snake::Reset() {
+  direction = Direction::kUp;
+  speed = 0.1f;
+  size = 1;
+  alive = true;
+  growing = false;
+  head_x = prev_head_x = static_cast<float>(grid_width / 2);
+  head_y = prev_head_y = static_cast<float>(grid_height / 2);
+  body.clear();
+  occupancy.Reset();
+  occupancy.Set(static_cast<int>(head_x), static_cast<int>(head_y));
+}
 
-// Inefficient method to check if cell is occupied by snake.
-bool Snake::SnakeCell(int x, int y) {
-  if (x == static_cast<int>(head_x) && y == static_cast<int>(head_y)) {
-    return true;
+void Snake::RestoreBody(std::vector<Point> const &cells, bool now_growing) {
+  growing = now_growing;
+  body.clear();
+  occupancy.Reset();
+  for (Point const &cell : cells) {
+    body.push_back(cell);
+    occupancy.Set(cell.x, cell.y);
   }
-  for (auto const &item : body) {
-    if (x == item.x && y == item.y) {
-      return true;
-    }
-  }
-  return false;
-}
\ No newline at end of file
+  occupancy.Set(static_cast<int>(head_x), static_cast<int>(head_y));
+}
+
+void Snake::GrowBody() { growing = true; }
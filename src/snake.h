@@ -20,23 +20,42 @@
 #ifndef SNAKE_H
 #define SNAKE_H
 
+#include <cstdint>
 #include <vector>
-#include "SDL.h"
+#include "point.h"
+#include "occupancy_grid.h"
+#include "ring_buffer.h"
 
 class Snake {
  public:
   enum class Direction { kUp, kDown, kLeft, kRight };
 
   Snake(int grid_width, int grid_height)
-      : grid_width(grid_width),
+      : head_x(grid_width / 2),
+        head_y(grid_height / 2),
+        prev_head_x(head_x),
+        prev_head_y(head_y),
+        body(static_cast<std::size_t>(grid_width) * grid_height),
+        grid_width(grid_width),
         grid_height(grid_height),
-        head_x(grid_width / 2),
-        head_y(grid_height / 2) {}
+        occupancy(grid_width, grid_height) {
+    occupancy.Set(static_cast<int>(head_x), static_cast<int>(head_y));
+  }
 
   void Update();
+  // Back to the starting state, keeping the allocated body and map storage.
+  void Reset();
+  // Replaces the body with `cells` (tail first) and rebuilds the occupancy
+  // map from them and the current head, in that order. Set the public
+  // fields first.
+  void RestoreBody(std::vector<Point> const &cells, bool now_growing);
 
   void GrowBody();
-  bool SnakeCell(int x, int y);
+  // Constant-time lookup against the occupancy bitmap (head and body).
+  bool SnakeCell(int x, int y) const { return occupancy.Test(x, y); }
+  OccupancyGrid const &Occupancy() const { return occupancy; }
+  // True if the next body push keeps the tail (food was just eaten).
+  bool Growing() const { return growing; }
 
   Direction direction = Direction::kUp;
 
@@ -45,15 +64,25 @@ class Snake {
   bool alive{true};
   float head_x;
   float head_y;
-  std::vector<SDL_Point> body;
+  // Head position before the latest Update(), for render interpolation.
+  float prev_head_x;
+  float prev_head_y;
+  // Body cells from tail (front) to neck (back), excluding the head. Sized
+  // to the whole board up front so moving never reallocates.
+  RingBuffer<Point> body;
+  // Segments ever pushed onto the body, so the neck's sequence number is
+  // body_pushes - 1. Not cleared by Reset(), which lets a renderer tell the
+  // segments of one game from those of the next.
+  std::uint64_t body_pushes{0};
 
  private:
   void UpdateHead();
-  void UpdateBody(SDL_Point &current_cell, SDL_Point &prev_cell);
+  void UpdateBody(Point &current_cell, Point &prev_cell);
 
   bool growing{false};
   int grid_width;
   int grid_height;
+  OccupancyGrid occupancy;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Incremental Snake Layer Bookkeeping Implementation
+ * ============================================================================
+ *
+ * File: snake_layer.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "snake_layer.h"
+#include <algorithm>
+#include <cstdlib>
+
+SnakeLayer::BandStarts SnakeLayer::ComputeBandStarts(std::uint64_t end_seq,
+                                                     std::size_t length) {
+  // Segment i (0 = tail) belongs to band floor(i * (kBands - 1) / (length - 1)),
+  // so the tail is band 0 and the neck band kBands - 1, as in the
+  // unquantized gradient.
+  std::uint64_t const first_seq = end_seq - length;
+  BandStarts starts;
+  starts[0] = first_seq;
+  for (int band = 1; band < kBands; ++band) {
+    if (length <= 1) {
+      starts[band] = end_seq;  // A lone segment stays in band 0
+    } else {
+      std::uint64_t const span = length - 1;
+      starts[band] = first_seq + (band * span + kBands - 2) / (kBands - 1);
+    }
+  }
+  starts[kBands] = end_seq;
+  return starts;
+}
+
+int SnakeLayer::BandOf(BandStarts const &starts, std::uint64_t seq) {
+  auto const after = std::upper_bound(starts.begin(), starts.end() - 1, seq);
+  return static_cast<int>(after - starts.begin()) - 1;
+}
+
+bool SnakeLayer::Joined(std::deque<Point> const &body,
+                        std::uint64_t first_seq, BandStarts const &starts,
+                        std::uint64_t seq) {
+  Point const cell = body[seq - first_seq];
+  Point const next = body[seq + 1 - first_seq];
+  int const dx = next.x - cell.x;
+  int const dy = next.y - cell.y;
+  int const band = BandOf(starts, seq);
+  if (std::abs(dx) + std::abs(dy) != 1 || BandOf(starts, seq + 1) != band) {
+    return false;
+  }
+  if (seq == first_seq) {
+    return true;
+  }
+
+  // A segment that continues the run before it must keep its direction;
+  // one that starts a run may go either way.
+  Point const previous = body[seq - 1 - first_seq];
+  int const in_dx = cell.x - previous.x;
+  int const in_dy = cell.y - previous.y;
+  if (std::abs(in_dx) + std::abs(in_dy) != 1 ||
+      BandOf(starts, seq - 1) != band) {
+    return true;
+  }
+  return in_dx == dx && in_dy == dy;
+}
+
+void SnakeLayer::AllRuns(std::deque<Point> const &body,
+                         std::uint64_t first_seq, BandStarts const &starts,
+                         std::vector<Run> &runs) {
+  std::uint64_t const end_seq = first_seq + body.size();
+  std::uint64_t run_begin = first_seq;
+  for (std::uint64_t seq = first_seq; seq < end_seq; ++seq) {
+    if (seq + 1 == end_seq || !Joined(body, first_seq, starts, seq)) {
+      runs.push_back({body[run_begin - first_seq], body[seq - first_seq],
+                      BandOf(starts, run_begin)});
+      run_begin = seq + 1;
+    }
+  }
+}
+
+void SnakeLayer::SplitRuns(std::deque<Point> const &body,
+                           std::uint64_t end_seq, std::vector<Run> &runs) {
+  runs.clear();
+  AllRuns(body, end_seq - body.size(),
+          ComputeBandStarts(end_seq, body.size()), runs);
+}
+
+bool SnakeLayer::Sync(std::deque<Point> const &body, std::uint64_t end_seq,
+                      std::vector<Point> &erase, std::vector<Run> &runs) {
+  erase.clear();
+  runs.clear();
+  dirty.clear();
+  std::size_t const length = body.size();
+  std::uint64_t const first_seq = end_seq - length;
+  BandStarts const starts = ComputeBandStarts(end_seq, length);
+
+  // The mirror can only be updated in place if it is an older window of
+  // the same sequence: nothing newer than the snapshot, nothing older than
+  // the snapshot's tail that is still in it, and matching cells where the
+  // two overlap.
+  std::uint64_t const mirror_end = mirror_first_seq + mirror.size();
+  bool rebuild = !valid || mirror_end > end_seq;
+  if (!rebuild && !mirror.empty()) {
+    std::uint64_t const overlap_begin = std::max(mirror_first_seq, first_seq);
+    if (overlap_begin < mirror_end) {
+      rebuild = mirror[overlap_begin - mirror_first_seq] !=
+                    body[overlap_begin - first_seq] ||
+                mirror.back() != body[mirror_end - 1 - first_seq];
+    }
+  }
+
+  if (rebuild) {
+    mirror.assign(body.begin(), body.end());
+    mirror_first_seq = first_seq;
+    band_starts = starts;
+    valid = true;
+    AllRuns(body, first_seq, starts, runs);
+    return true;
+  }
+
+  // Tail segments that have left the body; the new tail's run loses them
+  while (!mirror.empty() && mirror_first_seq < first_seq) {
+    erase.push_back(mirror.front());
+    mirror.pop_front();
+    ++mirror_first_seq;
+  }
+  if (mirror.empty()) {
+    mirror_first_seq = first_seq;
+  }
+  if (!erase.empty()) {
+    dirty.push_back(first_seq);
+  }
+  std::uint64_t const kept_end = mirror_first_seq + mirror.size();
+
+  // Whether segment `seq` ends its run depends on its neighbours' cells and
+  // bands, so a changed segment can reshape the runs from one before it to
+  // two after it.
+  auto changed = [this](std::uint64_t seq) {
+    for (std::uint64_t near = seq > 0 ? seq - 1 : 0; near <= seq + 2; ++near) {
+      dirty.push_back(near);
+    }
+  };
+
+  // Kept segments that moved across a band boundary. Boundaries only move
+  // forward and are visited in order, so each segment is visited once.
+  std::uint64_t next_unvisited = mirror_first_seq;
+  for (int band = 1; band < kBands; ++band) {
+    std::uint64_t const low =
+        std::max({std::min(band_starts[band], starts[band]), next_unvisited});
+    std::uint64_t const high =
+        std::min(std::max(band_starts[band], starts[band]), kept_end);
+    for (std::uint64_t seq = low; seq < high; ++seq) {
+      changed(seq);
+    }
+    next_unvisited = std::max(next_unvisited, high);
+  }
+
+  // New neck segments
+  for (std::uint64_t seq = std::max(kept_end, first_seq); seq < end_seq;
+       ++seq) {
+    mirror.push_back(body[seq - first_seq]);
+    changed(seq);
+  }
+  band_starts = starts;
+
+  // Each run that holds a dirty segment, once. Runs never overlap, so
+  // after sorting a dirty segment is either inside the last run found or
+  // past it.
+  std::sort(dirty.begin(), dirty.end());
+  std::uint64_t covered_end = first_seq;
+  for (std::uint64_t seq : dirty) {
+    if (seq < covered_end || seq >= end_seq) {
+      continue;
+    }
+    std::uint64_t run_begin = seq;
+    while (run_begin > first_seq &&
+           Joined(body, first_seq, starts, run_begin - 1)) {
+      --run_begin;
+    }
+    std::uint64_t run_last = seq;
+    while (run_last + 1 < end_seq &&
+           Joined(body, first_seq, starts, run_last)) {
+      ++run_last;
+    }
+    runs.push_back({body[run_begin - first_seq], body[run_last - first_seq],
+                    BandOf(starts, run_begin)});
+    covered_end = run_last + 1;
+  }
+  return false;
+}
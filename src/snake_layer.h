@@ -0,0 +1,99 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Incremental Snake Layer Bookkeeping
+ * ============================================================================
+ *
+ * File: snake_layer.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * Tracks which snake body cells are currently painted into the renderer's
+ * persistent snake layer texture and works out, for each new snapshot,
+ * the smallest set of cells to erase and repaint.
+ *
+ * The body is drawn as runs rather than cells: a run is a straight line
+ * of consecutive segments in the same gradient band, drawn as one
+ * stretched segment. A run ends at a corner, at a band boundary, where
+ * the body wraps around the board edge, and at the neck. A long snake is
+ * mostly straight, so it takes as many draws as it has turns and bands,
+ * not as it has segments.
+ *
+ * Each body segment is identified by its sequence number (see
+ * Snake::body_pushes), so a move is one new neck cell plus one removed
+ * tail cell, whatever the length. The tail-to-head gradient is quantized
+ * into kBands bands. As the snake moves, only the few cells that cross a
+ * band boundary change colour, so the work per frame depends on the
+ * number of changed cells, not on the length of the snake.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef SNAKE_LAYER_H
+#define SNAKE_LAYER_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "point.h"
+
+class SnakeLayer {
+ public:
+  static constexpr int kBands{32};
+
+  // Segments `first` to `last` (in body order, tail side first), all in
+  // one row or one column.
+  struct Run {
+    Point first;
+    Point last;
+    int band;  // 0 (tail) to kBands - 1 (neck)
+  };
+
+  // Brings the mirror in line with `body` (tail first) whose neck has
+  // sequence number `end_seq - 1`. On return `erase` holds vacated cells
+  // and `runs` the runs to redraw. Clear the erased cells and every cell
+  // the runs cover, then draw the runs. Returns true when the whole layer
+  // must be cleared first instead; `erase` is then empty and `runs`
+  // covers the entire body.
+  bool Sync(std::deque<Point> const &body, std::uint64_t end_seq,
+            std::vector<Point> &erase, std::vector<Run> &runs);
+
+  // Splits a whole body into runs, for drawing it without a layer.
+  static void SplitRuns(std::deque<Point> const &body, std::uint64_t end_seq,
+                        std::vector<Run> &runs);
+
+  // Forces the next Sync() to repaint everything (e.g. after the layer
+  // texture was recreated or its contents were lost).
+  void Invalidate() { valid = false; }
+
+  // Gradient position of a band, 0 at the tail to 1 at the neck.
+  static float BandRatio(int band) {
+    return static_cast<float>(band) / static_cast<float>(kBands - 1);
+  }
+
+ private:
+  using BandStarts = std::array<std::uint64_t, kBands + 1>;
+
+  // First sequence number of each band for a body of `length` segments
+  // ending at `end_seq`; entry kBands is `end_seq`.
+  static BandStarts ComputeBandStarts(std::uint64_t end_seq,
+                                      std::size_t length);
+  static int BandOf(BandStarts const &starts, std::uint64_t seq);
+  // Whether segments `seq` and `seq + 1` belong to the same run.
+  static bool Joined(std::deque<Point> const &body, std::uint64_t first_seq,
+                     BandStarts const &starts, std::uint64_t seq);
+  static void AllRuns(std::deque<Point> const &body, std::uint64_t first_seq,
+                      BandStarts const &starts, std::vector<Run> &runs);
+
+  bool valid{false};
+  std::deque<Point> mirror;  // Painted cells, tail first.
+  std::uint64_t mirror_first_seq{0};
+  BandStarts band_starts{};
+  // Segments whose run may have changed this Sync(); scratch space.
+  std::vector<std::uint64_t> dirty;
+};
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Board-Sized Snake Map and Occupancy Summary Implementation
+ * ============================================================================
+ *
+ * File: snake_map.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "snake_map.h"
+#include <algorithm>
+
+SnakeMap::SnakeMap(int grid_width, int grid_height)
+    : grid_width(grid_width), grid_height(grid_height) {
+  int const longest = std::max(grid_width, grid_height);
+  tile_size = (longest + kMaxSummarySide - 1) / kMaxSummarySide;
+  summary_width = (grid_width + tile_size - 1) / tile_size;
+  summary_height = (grid_height + tile_size - 1) / tile_size;
+  cells.assign(static_cast<std::size_t>(grid_width) * grid_height, 0);
+  tiles.assign(static_cast<std::size_t>(summary_width) * summary_height, 0);
+}
+
+void SnakeMap::Unjoin(Point const &cell) {
+  cells[Index(cell.x, cell.y)] &= kBandMask;
+  if (cell.x > 0) {
+    cells[Index(cell.x - 1, cell.y)] &= static_cast<std::uint8_t>(~kJoinsRight);
+  }
+  if (cell.y > 0) {
+    cells[Index(cell.x, cell.y - 1)] &= static_cast<std::uint8_t>(~kJoinsDown);
+  }
+}
+
+void SnakeMap::Apply(bool clear_all, std::vector<Point> const &erase,
+                     std::vector<SnakeLayer::Run> const &runs) {
+  if (clear_all) {
+    std::fill(cells.begin(), cells.end(), 0);
+    std::fill(tiles.begin(), tiles.end(), 0);
+    ++summary_version;
+  }
+
+  bool summary_changed = false;
+  for (Point const &cell : erase) {
+    if ((cells[Index(cell.x, cell.y)] & kBandMask) != 0) {
+      Unjoin(cell);
+      cells[Index(cell.x, cell.y)] = 0;
+      --Tile(cell);
+      summary_changed = true;
+    }
+  }
+
+  // Every run that changed is listed whole, so its cells' old joins can
+  // all be dropped before any are set again; joins inside runs that did
+  // not change are left alone.
+  auto for_each_cell = [](SnakeLayer::Run const &run, auto &&visit) {
+    int const dx = (run.last.x > run.first.x) - (run.last.x < run.first.x);
+    int const dy = (run.last.y > run.first.y) - (run.last.y < run.first.y);
+    Point cell = run.first;
+    while (true) {
+      visit(cell);
+      if (cell == run.last) {
+        break;
+      }
+      cell.x += dx;
+      cell.y += dy;
+    }
+  };
+  for (SnakeLayer::Run const &run : runs) {
+    for_each_cell(run, [this](Point const &cell) { Unjoin(cell); });
+  }
+  for (SnakeLayer::Run const &run : runs) {
+    std::uint8_t const band = static_cast<std::uint8_t>(run.band + 1);
+    for_each_cell(run, [&](Point const &cell) {
+      std::uint8_t &value = cells[Index(cell.x, cell.y)];
+      if ((value & kBandMask) == 0) {
+        ++Tile(cell);
+        summary_changed = true;
+      }
+      value = static_cast<std::uint8_t>((value & ~kBandMask) | band);
+    });
+    // Joins are stored on the left or upper cell of each pair
+    Point const low{std::min(run.first.x, run.last.x),
+                    std::min(run.first.y, run.last.y)};
+    Point const high{std::max(run.first.x, run.last.x),
+                     std::max(run.first.y, run.last.y)};
+    for (int x = low.x; x < high.x; ++x) {
+      cells[Index(x, low.y)] |= kJoinsRight;
+    }
+    for (int y = low.y; y < high.y; ++y) {
+      cells[Index(low.x, y)] |= kJoinsDown;
+    }
+  }
+  if (summary_changed) {
+    ++summary_version;
+  }
+}
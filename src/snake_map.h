@@ -0,0 +1,97 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Board-Sized Snake Map and Occupancy Summary
+ * ============================================================================
+ *
+ * File: snake_map.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * The renderer's copy of the snake for boards too large to draw whole.
+ * Every cell stores the gradient band of the segment on it (or nothing)
+ * and whether it shares a run (see SnakeLayer) with its right and lower
+ * neighbours, so drawing the part of the board under the camera is a walk
+ * over the visible cells instead of the whole body. A coarse grid of
+ * tiles, at most kMaxSummarySide on a side, counts the occupied cells
+ * under each tile for the minimap.
+ *
+ * Both are fed the erase and run lists from SnakeLayer::Sync(), so a tick
+ * costs a few cell updates whatever the size of the board or the length
+ * of the snake.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef SNAKE_MAP_H
+#define SNAKE_MAP_H
+
+#include <cstdint>
+#include <vector>
+#include "point.h"
+#include "snake_layer.h"
+
+class SnakeMap {
+ public:
+  static constexpr int kMaxSummarySide{128};
+
+  SnakeMap(int grid_width, int grid_height);
+
+  // Applies one SnakeLayer::Sync() result: clears the map first when
+  // `clear_all` is set, then erases and writes the runs in that order.
+  void Apply(bool clear_all, std::vector<Point> const &erase,
+             std::vector<SnakeLayer::Run> const &runs);
+
+  // Band of the segment on (x, y), or -1 for an empty cell.
+  int BandAt(int x, int y) const {
+    return static_cast<int>(cells[Index(x, y)] & kBandMask) - 1;
+  }
+  // Whether (x, y) and (x + 1, y), or (x, y + 1), are in the same run.
+  bool JoinsRight(int x, int y) const {
+    return (cells[Index(x, y)] & kJoinsRight) != 0;
+  }
+  bool JoinsDown(int x, int y) const {
+    return (cells[Index(x, y)] & kJoinsDown) != 0;
+  }
+
+  // Board cells per summary tile along each axis.
+  int TileSize() const { return tile_size; }
+  int SummaryWidth() const { return summary_width; }
+  int SummaryHeight() const { return summary_height; }
+  // Occupied cells under tile (tx, ty), out of TileSize() squared.
+  std::uint32_t TileCount(int tx, int ty) const {
+    return tiles[static_cast<std::size_t>(ty) * summary_width + tx];
+  }
+  // Bumped whenever a tile count changes, so a cached picture of the
+  // summary knows when to redraw.
+  std::uint64_t SummaryVersion() const { return summary_version; }
+
+ private:
+  static constexpr std::uint8_t kBandMask{0x3F};  // Band + 1, 0 when empty
+  static constexpr std::uint8_t kJoinsRight{0x40};
+  static constexpr std::uint8_t kJoinsDown{0x80};
+
+  // Drops the joins into and out of `cell`, keeping its band.
+  void Unjoin(Point const &cell);
+
+  std::size_t Index(int x, int y) const {
+    return static_cast<std::size_t>(y) * grid_width + x;
+  }
+  std::uint32_t &Tile(Point const &cell) {
+    return tiles[static_cast<std::size_t>(cell.y / tile_size) * summary_width +
+                 cell.x / tile_size];
+  }
+
+  int grid_width;
+  int grid_height;
+  int tile_size;
+  int summary_width;
+  int summary_height;
+  std::vector<std::uint8_t> cells;
+  std::vector<std::uint32_t> tiles;
+  std::uint64_t summary_version{0};
+};
+
+#endif
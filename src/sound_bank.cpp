@@ -0,0 +1,297 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Synthesized Sound Bank Implementation
+ * ============================================================================
+ *
+ * File: sound_bank.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "sound_bank.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SOUND_BANK_SSE2 1
+#endif
+
+namespace {
+
+// A sine tone with an optional linear pitch sweep, amplitude ramp and
+// linear fade in/out.
+struct Tone {
+    float frequency;  // Hz at t = 0
+    float chirp;      // Phase gains chirp * t^2 turns (Hz per second)
+    float amplitude;  // Peak sample value
+    float decay;      // Amplitude scales by (1 + decay * t)
+    float fade;       // Fraction of the length spent fading in and out
+    int duration_ms;
+};
+
+// Indexed by SoundBank::Sound.
+constexpr Tone kTones[SoundBank::kSoundCount] = {
+    // Eating - pleasant 800Hz chime with soft edges
+    {800.0f, 0.0f, 6000.0f, 0.0f, 0.1f, 200},
+    // Game over - descending from 400Hz to 200Hz while fading out
+    {400.0f, -200.0f, 8000.0f, -1.0f, 0.0f, 800},
+};
+
+constexpr char kMagic[8] = {'S', 'N', 'K', 'S', 'O', 'U', 'N', 'D'};
+constexpr std::uint32_t kByteOrderMark{0x01020304u};
+constexpr std::size_t kDataAlignment{16};
+
+struct CacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t sample_rate;
+    std::uint32_t channels;
+    std::uint32_t sound_count;
+    std::uint32_t reserved;
+};
+
+struct CacheEntry {
+    std::uint64_t offset;  // Bytes from the start of the file
+    std::uint64_t count;   // Interleaved samples
+};
+
+constexpr float kTwoPi{6.28318530717958647692f};
+
+// sin(2 * pi * x) for x in [-0.5, 0.5]. Folding into [-0.25, 0.25] keeps
+// the odd Taylor polynomial within a few millionths of full scale.
+inline float SinTurns(float x) {
+    float y = std::min(x, 0.5f - x);
+    y = std::max(y, -0.5f - y);
+    float const z = y * kTwoPi;
+    float const z2 = z * z;
+    float p = 2.7557319e-6f;
+    p = p * z2 - 1.9841270e-4f;
+    p = p * z2 + 8.3333333e-3f;
+    p = p * z2 - 1.6666667e-1f;
+    p = p * z2 + 1.0f;
+    return p * z;
+}
+
+#if defined(SOUND_BANK_SSE2)
+inline __m128 SinTurns(__m128 x) {
+    __m128 const half = _mm_set1_ps(0.5f);
+    __m128 y = _mm_min_ps(x, _mm_sub_ps(half, x));
+    y = _mm_max_ps(y, _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(half, y)));
+    __m128 const z = _mm_mul_ps(y, _mm_set1_ps(kTwoPi));
+    __m128 const z2 = _mm_mul_ps(z, z);
+    __m128 p = _mm_set1_ps(2.7557319e-6f);
+    p = _mm_sub_ps(_mm_mul_ps(p, z2), _mm_set1_ps(1.9841270e-4f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(8.3333333e-3f));
+    p = _mm_sub_ps(_mm_mul_ps(p, z2), _mm_set1_ps(1.6666667e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(p, z);
+}
+#endif
+
+// Renders `count` mono samples of `tone` into `out`.
+void RenderTone(Tone const& tone, int sample_rate, int count, std::int16_t* out) {
+    float const inv_rate = 1.0f / sample_rate;
+    float const fade_samples = tone.fade * count;
+    float const inv_fade = fade_samples > 0.0f ? 1.0f / fade_samples
+                                               : std::numeric_limits<float>::max();
+    float const total = static_cast<float>(count);
+
+    int i = 0;
+#if defined(SOUND_BANK_SSE2)
+    __m128 const rate_step = _mm_set1_ps(inv_rate);
+    __m128 const frequency = _mm_set1_ps(tone.frequency);
+    __m128 const chirp = _mm_set1_ps(tone.chirp);
+    __m128 const amplitude = _mm_set1_ps(tone.amplitude);
+    __m128 const decay = _mm_set1_ps(tone.decay);
+    __m128 const fade = _mm_set1_ps(inv_fade);
+    __m128 const one = _mm_set1_ps(1.0f);
+    __m128 const end = _mm_set1_ps(total);
+    __m128 index = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    __m128 const four = _mm_set1_ps(4.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 const t = _mm_mul_ps(index, rate_step);
+        __m128 const phase = _mm_mul_ps(t, _mm_add_ps(frequency, _mm_mul_ps(chirp, t)));
+        __m128 const wrapped = _mm_sub_ps(phase, _mm_cvtepi32_ps(_mm_cvtps_epi32(phase)));
+        __m128 const envelope = _mm_min_ps(
+            one, _mm_min_ps(_mm_mul_ps(index, fade), _mm_mul_ps(_mm_sub_ps(end, index), fade)));
+        __m128 const gain = _mm_mul_ps(
+            _mm_mul_ps(amplitude, _mm_add_ps(one, _mm_mul_ps(decay, t))), envelope);
+        __m128i const value = _mm_cvttps_epi32(_mm_mul_ps(gain, SinTurns(wrapped)));
+        __m128i const packed = _mm_packs_epi32(value, value);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), packed);
+        index = _mm_add_ps(index, four);
+    }
+#endif
+    // Scalar remainder, with the same operations as the vector loop
+    for (; i < count; ++i) {
+        float const index_f = static_cast<float>(i);
+        float const t = index_f * inv_rate;
+        float const phase = t * (tone.frequency + tone.chirp * t);
+        float const wrapped = phase - std::nearbyint(phase);
+        float const envelope =
+            std::min(1.0f, std::min(index_f * inv_fade, (total - index_f) * inv_fade));
+        float const gain = tone.amplitude * (1.0f + tone.decay * t) * envelope;
+        out[i] = static_cast<std::int16_t>(static_cast<std::int32_t>(gain * SinTurns(wrapped)));
+    }
+}
+
+}  // namespace
+
+char const* SoundBank::Name(Sound sound) {
+    switch (sound) {
+        case Sound::kEat:
+            return "eat";
+        case Sound::kGameOver:
+            return "gameover";
+    }
+    return "";
+}
+
+SoundBank SoundBank::Synthesize(int sample_rate, int channels) {
+    SoundBank bank;
+    bank.sample_rate = sample_rate;
+    bank.channels = channels;
+
+    // Size the whole bank up front so every sound lands in one allocation.
+    std::array<int, kSoundCount> frames;
+    std::size_t total = 0;
+    for (int s = 0; s < kSoundCount; ++s) {
+        frames[s] = static_cast<int>(static_cast<std::int64_t>(sample_rate) *
+                                     kTones[s].duration_ms / 1000);
+        total += static_cast<std::size_t>(frames[s]) * channels;
+    }
+    bank.owned.resize(total);
+
+    std::vector<std::int16_t> mono;
+    std::size_t offset = 0;
+    for (int s = 0; s < kSoundCount; ++s) {
+        mono.resize(frames[s]);
+        RenderTone(kTones[s], sample_rate, frames[s], mono.data());
+
+        std::int16_t* out = bank.owned.data() + offset;
+        for (int i = 0; i < frames[s]; ++i) {
+            std::fill_n(out + static_cast<std::size_t>(i) * channels, channels, mono[i]);
+        }
+        std::size_t const count = static_cast<std::size_t>(frames[s]) * channels;
+        bank.spans[s] = {out, count};
+        offset += count;
+    }
+    return bank;
+}
+
+SoundBank SoundBank::LoadOrSynthesize(std::string const& cache_path, int sample_rate,
+                                      int channels) {
+    SoundBank bank;
+    if (!cache_path.empty() && bank.LoadCache(cache_path, sample_rate, channels)) {
+        return bank;
+    }
+    bank = Synthesize(sample_rate, channels);
+    if (!cache_path.empty()) {
+        bank.SaveCache(cache_path);
+    }
+    return bank;
+}
+
+bool SoundBank::LoadCache(std::string const& path, int rate, int channel_count) {
+    MappedFile file;
+    if (!file.Open(path) || file.Size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion || header.byte_order != kByteOrderMark ||
+        header.sample_rate != static_cast<std::uint32_t>(rate) ||
+        header.channels != static_cast<std::uint32_t>(channel_count) ||
+        header.sound_count != static_cast<std::uint32_t>(kSoundCount)) {
+        return false;
+    }
+    std::size_t const table_end = sizeof(CacheHeader) + kSoundCount * sizeof(CacheEntry);
+    if (file.Size() < table_end) {
+        return false;
+    }
+
+    std::array<Span, kSoundCount> mapped;
+    for (int s = 0; s < kSoundCount; ++s) {
+        CacheEntry entry;
+        std::memcpy(&entry, file.Data() + sizeof(CacheHeader) + s * sizeof(CacheEntry),
+                    sizeof(entry));
+        // Compared in samples: count * 2 could wrap to a small size.
+        if (entry.offset < table_end || entry.offset % alignof(std::int16_t) != 0 ||
+            entry.offset > file.Size() ||
+            entry.count > (file.Size() - entry.offset) / sizeof(std::int16_t)) {
+            return false;
+        }
+        mapped[s] = {reinterpret_cast<std::int16_t const*>(file.Data() + entry.offset),
+                     static_cast<std::size_t>(entry.count)};
+    }
+
+    sample_rate = rate;
+    channels = channel_count;
+    spans = mapped;
+    owned.clear();
+    owned.shrink_to_fit();
+    mapping = std::move(file);
+    return true;
+}
+
+bool SoundBank::SaveCache(std::string const& path) const {
+    CacheHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrderMark;
+    header.sample_rate = static_cast<std::uint32_t>(sample_rate);
+    header.channels = static_cast<std::uint32_t>(channels);
+    header.sound_count = static_cast<std::uint32_t>(kSoundCount);
+
+    std::array<CacheEntry, kSoundCount> entries;
+    std::uint64_t offset = sizeof(CacheHeader) + sizeof(entries);
+    for (int s = 0; s < kSoundCount; ++s) {
+        offset = (offset + kDataAlignment - 1) / kDataAlignment * kDataAlignment;
+        entries[s] = {offset, spans[s].count};
+        offset += spans[s].count * sizeof(std::int16_t);
+    }
+
+    // Write a temporary file and rename it over the cache, so a crash or a
+    // second instance never leaves a half-written bank behind.
+    std::string const temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(reinterpret_cast<char const*>(entries.data()), sizeof(entries));
+        std::uint64_t written = sizeof(CacheHeader) + sizeof(entries);
+        char const padding[kDataAlignment] = {};
+        for (int s = 0; s < kSoundCount; ++s) {
+            out.write(padding, static_cast<std::streamsize>(entries[s].offset - written));
+            out.write(reinterpret_cast<char const*>(spans[s].samples),
+                      static_cast<std::streamsize>(spans[s].count * sizeof(std::int16_t)));
+            written = entries[s].offset + spans[s].count * sizeof(std::int16_t);
+        }
+        if (!out) {
+            out.close();
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+#if defined(_WIN32)
+    std::remove(path.c_str());  // rename() does not replace files here
+#endif
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,87 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Synthesized Sound Bank
+ * ============================================================================
+ *
+ * File: sound_bank.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ *
+ * Description:
+ * Renders the game's procedural sound effects into one block of
+ * interleaved 16-bit PCM. The oscillator and envelope loops run four
+ * samples at a time, using a polynomial sine on a wrapped phase in place
+ * of one sin() call per sample.
+ *
+ * The rendered bank can be saved to a versioned cache file. Later launches
+ * memory-map that file and play straight from the mapped pages, so nothing
+ * is synthesized and nothing is copied. A cache written by another
+ * version, sample rate or channel count is ignored and rewritten.
+ *
+ * Everything here is SDL-free and thread-safe to build on a background
+ * thread.
+ *
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef SOUND_BANK_H
+#define SOUND_BANK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "mapped_file.h"
+
+class SoundBank {
+public:
+    // Bump whenever a tone or the synthesis changes, so stale cache files
+    // are regenerated.
+    static constexpr std::uint32_t kVersion{1};
+
+    enum class Sound { kEat, kGameOver };
+    static constexpr int kSoundCount{2};
+    static char const* Name(Sound sound);
+
+    // Renders every sound at `sample_rate` with `channels` interleaved
+    // (identical) channels.
+    static SoundBank Synthesize(int sample_rate, int channels);
+
+    // Maps `cache_path` if it holds a bank for this version and format,
+    // otherwise synthesizes one and tries to save it there. An empty path
+    // disables caching.
+    static SoundBank LoadOrSynthesize(std::string const& cache_path,
+                                      int sample_rate, int channels);
+
+    // Maps a cache file; false if it is missing or does not match.
+    bool LoadCache(std::string const& path, int sample_rate, int channels);
+    bool SaveCache(std::string const& path) const;
+
+    // Interleaved samples of `sound`; valid as long as the bank is.
+    std::int16_t const* Samples(Sound sound) const {
+        return spans[static_cast<int>(sound)].samples;
+    }
+    std::size_t SampleCount(Sound sound) const {
+        return spans[static_cast<int>(sound)].count;
+    }
+    bool FromCache() const { return mapping.IsOpen(); }
+
+private:
+    struct Span {
+        std::int16_t const* samples{nullptr};
+        std::size_t count{0};
+    };
+
+    int sample_rate{0};
+    int channels{0};
+    std::array<Span, kSoundCount> spans{};
+
+    // Backing storage: either freshly synthesized or a mapped cache file.
+    std::vector<std::int16_t> owned;
+    MappedFile mapping;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Single-Producer Single-Consumer Queue
+ * ============================================================================
+ * 
+ * File: spsc_queue.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Bounded lock-free ring for handing small messages from exactly one
+ * producer thread to exactly one consumer thread. Push and Pop never block
+ * or allocate; Push fails when the ring is full.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+  static_assert((Capacity & (Capacity - 1)) == 0,
+                "SpscQueue capacity must be a power of two");
+
+ public:
+  // Producer side.
+  bool Push(T const &value) {
+    std::size_t const tail = write_index.load(std::memory_order_relaxed);
+    if (tail - read_index.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    slots[tail & (Capacity - 1)] = value;
+    write_index.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side.
+  bool Pop(T &value) {
+    std::size_t const head = read_index.load(std::memory_order_relaxed);
+    if (head == write_index.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = slots[head & (Capacity - 1)];
+    read_index.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  std::array<T, Capacity> slots{};
+  // Kept on separate cache lines so producer and consumer do not contend.
+  alignas(64) std::atomic<std::size_t> write_index{0};
+  alignas(64) std::atomic<std::size_t> read_index{0};
+};
+
+#endif
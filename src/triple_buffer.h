@@ -0,0 +1,70 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Lock-Free Triple Buffer
+ * ============================================================================
+ * 
+ * File: triple_buffer.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Hands the latest complete value from one writer thread to one reader
+ * thread without locks and without either side ever waiting. The writer
+ * fills its private back slot and publishes it by swapping it with the
+ * shared middle slot; the reader swaps the middle slot into its private
+ * front slot whenever a fresh one is available. Intermediate values the
+ * reader never picked up are simply overwritten.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+ public:
+  // All three slots start as copies of `prototype`. Copies do not keep a
+  // container's spare capacity, so reserving in the prototype is no use.
+  explicit TripleBuffer(T const &prototype = T())
+      : slots{prototype, prototype, prototype} {}
+
+  // Writer side: fill WriteBuffer(), then Publish() it.
+  T &WriteBuffer() { return slots[back]; }
+  void Publish() {
+    std::uint8_t const previous =
+        middle.exchange(static_cast<std::uint8_t>(back | kFresh),
+                        std::memory_order_acq_rel);
+    back = previous & kIndexMask;
+  }
+
+  // Reader side: Acquire() returns true if a newer value was swapped into
+  // ReadBuffer() since the last call.
+  bool Acquire() {
+    if (!(middle.load(std::memory_order_relaxed) & kFresh)) {
+      return false;
+    }
+    std::uint8_t const previous =
+        middle.exchange(front, std::memory_order_acq_rel);
+    front = previous & kIndexMask;
+    return true;
+  }
+  T const &ReadBuffer() const { return slots[front]; }
+
+ private:
+  static constexpr std::uint8_t kIndexMask{0x3};
+  static constexpr std::uint8_t kFresh{0x4};
+
+  std::array<T, 3> slots;
+  alignas(64) std::atomic<std::uint8_t> middle{1};
+  alignas(64) std::uint8_t back{0};   // Owned by the writer.
+  alignas(64) std::uint8_t front{2};  // Owned by the reader.
+};
+
+#endif
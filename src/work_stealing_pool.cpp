@@ -0,0 +1,154 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Work-Stealing Thread Pool Implementation
+ * ============================================================================
+ * 
+ * File: work_stealing_pool.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include "work_stealing_pool.h"
+#include <algorithm>
+
+WorkStealingPool::WorkStealingPool(unsigned thread_count) {
+  if (thread_count == 0) {
+    thread_count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (unsigned i = 0; i < thread_count; ++i) {
+    queues.push_back(std::make_unique<Queue>());
+  }
+  for (unsigned i = 1; i < thread_count; ++i) {
+    workers.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(job_mutex);
+    stopping = true;
+  }
+  job_cv.notify_all();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+void WorkStealingPool::ParallelFor(std::size_t count, std::size_t grain,
+                                   RangeTask const &task) {
+  if (count == 0) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(job_mutex);
+    this->task = &task;
+    this->grain = std::max<std::size_t>(1, grain);
+
+    // Seed every participant with an equal contiguous share.
+    std::size_t const participants = queues.size();
+    for (std::size_t i = 0; i < participants; ++i) {
+      std::size_t const begin = count * i / participants;
+      std::size_t const end = count * (i + 1) / participants;
+      if (begin < end) {
+        std::lock_guard<std::mutex> queue_lock(queues[i]->mutex);
+        queues[i]->ranges.push_back({begin, end});
+      }
+    }
+    remaining.store(count, std::memory_order_release);
+    ++generation;
+  }
+  job_cv.notify_all();
+
+  RunTasks(0);
+
+  std::unique_lock<std::mutex> lock(job_mutex);
+  done_cv.wait(lock, [this] {
+    return remaining.load(std::memory_order_acquire) == 0 && busy_workers == 0;
+  });
+  this->task = nullptr;
+}
+
+void WorkStealingPool::WorkerLoop(unsigned index) {
+  std::uint64_t seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(job_mutex);
+      job_cv.wait(lock, [&] {
+        return stopping || generation != seen_generation;
+      });
+      if (stopping) {
+        return;
+      }
+      seen_generation = generation;
+      ++busy_workers;
+    }
+
+    RunTasks(index);
+
+    {
+      std::lock_guard<std::mutex> lock(job_mutex);
+      --busy_workers;
+    }
+    done_cv.notify_all();
+  }
+}
+
+void WorkStealingPool::RunTasks(unsigned index) {
+  Range range;
+  while (remaining.load(std::memory_order_acquire) > 0) {
+    if (PopLocal(index, range) || Steal(index, range)) {
+      (*task)(range.begin, range.end);
+      remaining.fetch_sub(range.end - range.begin, std::memory_order_acq_rel);
+    } else {
+      // Everything left is already running on other threads.
+      std::this_thread::yield();
+    }
+  }
+}
+
+bool WorkStealingPool::PopLocal(unsigned index, Range &range) {
+  Queue &queue = *queues[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.ranges.empty()) {
+    return false;
+  }
+  range = queue.ranges.back();
+  queue.ranges.pop_back();
+
+  // Split off upper halves until the chunk is small enough; they stay at
+  // the back for us, while thieves take from the front.
+  while (range.end - range.begin > grain) {
+    std::size_t const middle = range.begin + (range.end - range.begin) / 2;
+    queue.ranges.push_back({middle, range.end});
+    range.end = middle;
+  }
+  return true;
+}
+
+bool WorkStealingPool::Steal(unsigned thief, Range &range) {
+  std::size_t const participants = queues.size();
+  for (std::size_t offset = 1; offset < participants; ++offset) {
+    Queue &victim = *queues[(thief + offset) % participants];
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (victim.ranges.empty()) {
+        continue;
+      }
+      range = victim.ranges.front();
+      victim.ranges.pop_front();
+    }
+    // Keep one chunk and move the rest of the stolen range to our own deque.
+    if (range.end - range.begin > grain) {
+      Range const rest{range.begin + grain, range.end};
+      range.end = range.begin + grain;
+      std::lock_guard<std::mutex> lock(queues[thief]->mutex);
+      queues[thief]->ranges.push_back(rest);
+    }
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,84 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Work-Stealing Thread Pool
+ * ============================================================================
+ * 
+ * File: work_stealing_pool.h
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Persistent worker threads that execute parallel loops over an index
+ * range. Each participant (the calling thread plus every worker) owns a
+ * deque of index ranges. A participant halves large ranges from the back
+ * of its own deque until a chunk is at most `grain` long, and when its
+ * deque runs dry it steals the oldest, largest range from the front of a
+ * peer's. Uneven chunks (games that end early, bursts of restarts) are
+ * rebalanced without any up-front tuning.
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+ public:
+  using RangeTask = std::function<void(std::size_t begin, std::size_t end)>;
+
+  // `thread_count` includes the calling thread; 0 means one per core.
+  explicit WorkStealingPool(unsigned thread_count = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(WorkStealingPool const &) = delete;
+  WorkStealingPool &operator=(WorkStealingPool const &) = delete;
+
+  // Runs task over [0, count) in chunks of at most `grain` indices and
+  // returns once every chunk has finished. The caller takes part.
+  void ParallelFor(std::size_t count, std::size_t grain, RangeTask const &task);
+
+  unsigned ThreadCount() const { return static_cast<unsigned>(queues.size()); }
+
+ private:
+  struct Range {
+    std::size_t begin;
+    std::size_t end;
+  };
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Range> ranges;
+  };
+
+  void WorkerLoop(unsigned index);
+  void RunTasks(unsigned index);
+  bool PopLocal(unsigned index, Range &range);
+  bool Steal(unsigned thief, Range &range);
+
+  std::vector<std::unique_ptr<Queue>> queues;  // [0] belongs to the caller.
+  std::vector<std::thread> workers;
+
+  std::mutex job_mutex;
+  std::condition_variable job_cv;
+  std::condition_variable done_cv;
+  RangeTask const *task{nullptr};
+  std::size_t grain{1};
+  std::uint64_t generation{0};
+  unsigned busy_workers{0};
+  bool stopping{false};
+  std::atomic<std::size_t> remaining{0};
+};
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * ============================================================================
+ * SnakeGame-C - Headless Simulation Driver
+ * ============================================================================
+ * 
+ * File: snake_headless.cpp
+ * Author: Your Name
+ * Created: 2025
+ * Version: 1.0.0
+ * 
+ * Description:
+ * Runs the snake_core simulation without a window or audio device. A batch
+ * of seeded games is stepped as fast as possible under the autopilot on
+ * the work-stealing pool, restarting each one when it ends, and the
+ * aggregate tick rate is reported. With --scaling the same batch is re-run
+ * at 1, 2, 4, ... threads to show how throughput scales with core count.
+ * 
+ * With --replay it instead plays a recorded game as fast as possible,
+ * checking every tick's checksum, and reports where playback ended. With
+ * --seek it first times a jump to the given tick through the replay's
+ * keyframe index, then plays on from there.
+ * 
+ * Usage:
+ *   snake_headless [--games N] [--grid W H] [--ticks T] [--seed S]
+ *                  [--threads T] [--block B] [--scaling]
+ *   snake_headless --replay FILE [--seek TICK]
+ * 
+ * Copyright (c) 2025 Your Name. All rights reserved.
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "batch_engine.h"
+#include "board_limits.h"
+#include "replay.h"
+#include "work_stealing_pool.h"
+
+namespace {
+
+struct Options {
+  int games{1024};
+  int grid_width{32};
+  int grid_height{32};
+  long ticks{10000};  // Per game.
+  std::uint64_t seed{1};
+  unsigned threads{0};  // 0 = one per core.
+  int block{64};        // Ticks per game per scheduling round.
+  bool scaling{false};
+  std::string replay_path;
+  long seek{-1};
+};
+
+void PrintUsage() {
+  std::cerr << "Usage: snake_headless [--games N] [--grid W H] [--ticks T] "
+               "[--seed S] [--threads T] [--block B] [--scaling]\n"
+               "       snake_headless --replay FILE [--seek TICK]\n";
+}
+
+bool ParseOptions(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+      options.games = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--grid") == 0 && i + 2 < argc) {
+      options.grid_width = std::atoi(argv[++i]);
+      options.grid_height = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+      options.ticks = std::atol(argv[++i]);
+    } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      options.seed = std::strtoull(argv[++i], nullptr, 10);
+    } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      options.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--block") == 0 && i + 1 < argc) {
+      options.block = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--scaling") == 0) {
+      options.scaling = true;
+    } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      options.replay_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--seek") == 0 && i + 1 < argc) {
+      options.seek = std::atol(argv[++i]);
+    } else {
+      return false;
+    }
+  }
+  return options.games > 0 &&
+         ValidGridSize(options.grid_width, options.grid_height) &&
+         options.ticks > 0 && options.block > 0;
+}
+
+struct RunResult {
+  double seconds;
+  BatchTotals totals;
+};
+
+RunResult RunBatch(Options const &options, unsigned threads) {
+  WorkStealingPool pool(threads);
+  BatchEngine engine(static_cast<std::size_t>(options.games),
+                     options.grid_width, options.grid_height, options.seed);
+
+  auto const start = std::chrono::steady_clock::now();
+  for (long done = 0; done < options.ticks; done += options.block) {
+    long const block = std::min<long>(options.block, options.ticks - done);
+    engine.Step(pool, static_cast<int>(block));
+  }
+  double const seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  return {seconds, engine.Totals()};
+}
+
+// Plays a replay at full speed. Returns the process exit code: 0 if it
+// played to its end (cleanly closed or cut short), 1 otherwise.
+int PlayReplay(std::string const &path, long seek) {
+  ReplayReader reader;
+  if (!reader.Open(path)) {
+    std::cerr << "Could not read replay " << path << "\n";
+    return 1;
+  }
+  ReplayPlayer player(std::move(reader));
+  ReplayHeader const &header = player.Header();
+  std::cout << "replay:         " << header.grid_width << "x"
+            << header.grid_height << ", seed " << header.seed << ", "
+            << player.TickCount() << " ticks\n";
+
+  Simulation simulation = player.MakeSimulation();
+  TickEvents events;
+  ReplayPlayer::Status status = ReplayPlayer::Status::kTicked;
+  if (seek >= 0) {
+    auto const seek_start = std::chrono::steady_clock::now();
+    status = player.SeekTo(simulation, static_cast<std::uint64_t>(seek));
+    double const ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - seek_start)
+                          .count();
+    std::cout << "seek:           tick " << player.Tick() << " in " << ms
+              << " ms\n";
+  }
+  std::uint64_t const first_tick = player.Tick();
+  auto const start = std::chrono::steady_clock::now();
+  while (status == ReplayPlayer::Status::kTicked) {
+    status = player.Step(simulation, events);
+  }
+  double const seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+
+  std::cout << "result:         " << ReplayPlayer::StatusName(status)
+            << " at tick " << player.Tick() << "\n";
+  if (status == ReplayPlayer::Status::kDesync) {
+    std::cout << "checksum:       " << std::hex << player.ActualChecksum()
+              << ", recorded " << player.ExpectedChecksum() << std::dec
+              << "\n";
+  }
+  std::uint64_t const played = player.Tick() - first_tick;
+  std::cout << "elapsed:        " << seconds << " s ("
+            << static_cast<double>(played) / header.ticks_per_second
+            << " s of play)\n";
+  if (seconds > 0.0) {
+    std::cout << "ticks/second:   " << static_cast<long long>(played / seconds)
+              << "\n";
+  }
+  std::cout << "score:          " << simulation.GetScore() << "\n";
+  return status == ReplayPlayer::Status::kFinished ||
+                 status == ReplayPlayer::Status::kTruncated
+             ? 0
+             : 1;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    PrintUsage();
+    return 1;
+  }
+  if (!options.replay_path.empty()) {
+    return PlayReplay(options.replay_path, options.seek);
+  }
+  unsigned const max_threads = WorkStealingPool(options.threads).ThreadCount();
+
+  std::cout << "games:          " << options.games << " on "
+            << options.grid_width << "x" << options.grid_height << ", "
+            << options.ticks << " ticks each\n";
+
+  if (options.scaling) {
+    std::cout << "threads  ticks/second   speedup\n";
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+      thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    double baseline = 0.0;
+    for (unsigned threads : thread_counts) {
+      RunResult const result = RunBatch(options, threads);
+      double const rate = result.totals.ticks / result.seconds;
+      if (threads == 1) {
+        baseline = rate;
+      }
+      std::cout << threads << "\t " << static_cast<long long>(rate) << "\t"
+                << rate / baseline << "x\n";
+    }
+    return 0;
+  }
+
+  RunResult const result = RunBatch(options, max_threads);
+  std::cout << "threads:        " << max_threads << "\n";
+  std::cout << "ticks:          " << result.totals.ticks << "\n";
+  std::cout << "elapsed:        " << result.seconds << " s\n";
+  std::cout << "ticks/second:   "
+            << static_cast<long long>(result.totals.ticks / result.seconds)
+            << "\n";
+  std::cout << "games finished: " << result.totals.games_finished;
+  if (result.totals.games_finished > 0) {
+    std::cout << " (mean score "
+              << static_cast<double>(result.totals.score) /
+                     result.totals.games_finished
+              << ")";
+  }
+  std::cout << "\n";
+  return 0;
+}